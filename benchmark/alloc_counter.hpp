@@ -0,0 +1,51 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// counts every global operator new of the benchmark binary, include it in one translation unit only.
+// kept out of line so the compiler does not pair an inlined malloc()/free() with new/delete.
+inline std::atomic<std::size_t> g_alloc_count{0};
+
+class AllocCounter {
+    std::size_t m_start = g_alloc_count.load();
+
+  public:
+    void reset() {
+        m_start = g_alloc_count.load();
+    }
+
+    std::size_t count() const {
+        return g_alloc_count.load() - m_start;
+    }
+};
+
+[[gnu::noinline]] void* operator new(std::size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+    throw std::bad_alloc{};
+}
+
+[[gnu::noinline]] void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif // ALLOC_COUNTER_H
@@ -1,3 +1,4 @@
+#include "alloc_counter.hpp"
 #include "bench_timer.hpp"
 #include <array>
 #include <iostream>
@@ -16,13 +17,54 @@ using namespace df;
 #define COUNT__ITER_COL_BENCH  1000
 #define COUNT__ITER_SORT_BENCH 1000
 #define COUNT__ITER_COPY_BENCH 30
+#define COUNT__ITER_MOVE_BENCH 30
+
+#define PAR_SORT_BENCH_ROW_COUNT   4000000
+#define COUNT__ITER_PAR_SORT_BENCH 10
+
+#define SIMD_BENCH_SIZE        (1 << 22)
+#define COUNT__ITER_SIMD_BENCH 20
+
+#define DESCRIBE_BENCH_COL_COUNT   32
+#define DESCRIBE_BENCH_ROW_COUNT   250000
+#define COUNT__ITER_DESCRIBE_BENCH 10
+
+#define COUNT__ITER_ALGO_BENCH 10
+
+#define CHUNKED_BENCH_ROW_COUNT   1000000
+#define COUNT__ITER_CHUNKED_BENCH 5
 
 #define DF_BENCH
 #define ROW_BENCH
 #define COL_BENCH
+#define COL_MAJOR_BENCH
 // #define SORT_BENCH // REMOVED
 #define ROW_SORT_BENCH
+#define PAR_SORT_BENCH
 // #define COPY_BENCH
+#define MOVE_BENCH
+#define SIMD_BENCH
+#define DESCRIBE_BENCH
+#define ALGO_BENCH
+#define CHUNKED_BENCH
+
+template<typename T>
+DataFrame<T> make_frame(const std::vector<std::string>& col_names, const std::vector<std::string>& row_names) {
+    DataFrame<T> frame{col_names, row_names};
+    frame[0] = T{1};
+    return frame;
+}
+
+// bytes: memory read + written by one iteration.
+template<unsigned long N>
+void print_bandwidth_result(std::array<std::chrono::nanoseconds, N> data, std::size_t bytes, const char* bench_name) {
+    std::chrono::nanoseconds sum = {};
+    for (std::size_t i = 0; i < N; i++) {
+        sum += data[i];
+    }
+    double avg_ns = static_cast<double>(sum.count()) / static_cast<double>(N);
+    std::cout << "    " << bench_name << ", " << static_cast<double>(bytes) / avg_ns << " GB/s\n";
+}
 
 template<typename TimeUnit, unsigned long N>
 void print_bench_result(std::array<std::chrono::nanoseconds, N> data, const char* bench_name) {
@@ -66,10 +108,10 @@ int main() {
     for (std::size_t i = 0; i < COUNT__ITER_DF_BENCH; i++) {
         nsec_timer.tick();
         // for ( std::size_t i = 0; i < df.size(); i++) {
-        //   auto v = df[i].value;
+        //   auto v = df[i];
         // }
         for (const auto& cell : df) {
-            auto c __attribute__((unused)) = cell.value;
+            auto c __attribute__((unused)) = cell;
         }
         nsec_timer.tock();
         DataFrameIterator_bench_data[i] = nsec_timer.duration();
@@ -79,10 +121,10 @@ int main() {
     for (std::size_t i = 0; i < COUNT__ITER_DF_BENCH; i++) {
         nsec_timer.tick();
         // for ( std::size_t i = 0; i < df.size(); i++) {
-        //   df[i].value = 234234.234478;
+        //   df[i] = 234234.234478;
         // }
         for (auto& cell : df) {
-            cell.value = 234234.234478;
+            cell = 234234.234478;
         }
         nsec_timer.tock();
         DataFrameIterator_bench_data[i] = nsec_timer.duration();
@@ -92,7 +134,7 @@ int main() {
     for (std::size_t i = 0; i < COUNT__ITER_DF_BENCH; i++) {
         std::size_t rand_idx = static_cast<std::size_t>(rand()) % (df.size() - 1);
         nsec_timer.tick();
-        auto v __attribute__((unused)) = df[rand_idx].value;
+        auto v __attribute__((unused)) = df[rand_idx];
         nsec_timer.tock();
         DataFrameIterator_bench_data[i] = nsec_timer.duration();
     }
@@ -102,7 +144,7 @@ int main() {
         std::string col_name{"col-" + std::to_string(static_cast<std::size_t>(rand()) % (df.col_size() - 1))};
         std::string row_name{"row-" + std::to_string(static_cast<std::size_t>(rand()) % (df.row_size() - 1))};
         nsec_timer.tick();
-        auto v __attribute__((unused)) = df[col_name, row_name].value;
+        auto v __attribute__((unused)) = df[col_name, row_name];
         nsec_timer.tock();
         DataFrameIterator_bench_data[i] = nsec_timer.duration();
     }
@@ -111,7 +153,7 @@ int main() {
     for (std::size_t i = 0; i < COUNT__ITER_DF_BENCH; i++) {
         std::size_t rand_idx = static_cast<std::size_t>(rand()) % (df.size() - 1);
         nsec_timer.tick();
-        df[rand_idx].value = 234234.234478;
+        df[rand_idx] = 234234.234478;
         nsec_timer.tock();
         DataFrameIterator_bench_data[i] = nsec_timer.duration();
     }
@@ -121,7 +163,7 @@ int main() {
         std::string col_name{"col-" + std::to_string(static_cast<std::size_t>(rand()) % (df.col_size() - 1))};
         std::string row_name{"row-" + std::to_string(static_cast<std::size_t>(rand()) % (df.row_size() - 1))};
         nsec_timer.tick();
-        df[col_name, row_name].value = 159159.159;
+        df[col_name, row_name] = 159159.159;
         nsec_timer.tock();
         DataFrameIterator_bench_data[i] = nsec_timer.duration();
     }
@@ -136,7 +178,7 @@ int main() {
         nsec_timer.tick();
         for (auto i = df.iter_rows(); i < df.end(); i++) {
             for (const auto& c : i.current_row()) {
-                auto v __attribute__((unused)) = c->value;
+                auto v __attribute__((unused)) = c;
             }
         }
         nsec_timer.tock();
@@ -149,7 +191,7 @@ int main() {
         nsec_timer.tick();
         for (auto i = df.iter_rows(); i.current_row_idx() < row_count; i++) {
             for (auto& c : i.current_row()) {
-                c->value = 136136.136;
+                c = 136136.136;
             }
         }
         nsec_timer.tock();
@@ -162,7 +204,7 @@ int main() {
         nsec_timer.tick();
         auto row = df.row(rand_idx);
         for (const auto& c : row) {
-            auto v __attribute__((unused)) = c->value;
+            auto v __attribute__((unused)) = c;
         }
         nsec_timer.tock();
         RowIterator_bench_data[i] = nsec_timer.duration();
@@ -174,7 +216,7 @@ int main() {
         nsec_timer.tick();
         auto row = df.row(rand_idx);
         for (auto& c : row) {
-            c->value = 789789.789;
+            c = 789789.789;
         }
         nsec_timer.tock();
         RowIterator_bench_data[i] = nsec_timer.duration();
@@ -190,7 +232,7 @@ int main() {
         nsec_timer.tick();
         for (auto i = df.iter_cols(); i < df.end(); i++) {
             for (auto& c : i.current_col()) {
-                auto v __attribute__((unused)) = c->value;
+                auto v __attribute__((unused)) = c;
             }
         }
         nsec_timer.tock();
@@ -203,7 +245,7 @@ int main() {
         nsec_timer.tick();
         for (auto col = df.iter_cols(); col.current_col_idx() < col_count; col++) {
             for (auto& c : col.current_col()) {
-                c->value = 456456.456;
+                c = 456456.456;
             }
         }
         nsec_timer.tock();
@@ -216,7 +258,7 @@ int main() {
         nsec_timer.tick();
         auto col = df.column(rand_idx);
         for (auto& c : col) {
-            auto v __attribute__((unused)) = c->value;
+            auto v __attribute__((unused)) = c;
         }
         nsec_timer.tock();
         ColumnIterator_bench_data[i] = nsec_timer.duration();
@@ -228,7 +270,7 @@ int main() {
         nsec_timer.tick();
         auto col = df.column(rand_idx);
         for (auto& c : col) {
-            c->value = 123123.123;
+            c = 123123.123;
         }
         nsec_timer.tock();
         ColumnIterator_bench_data[i] = nsec_timer.duration();
@@ -236,6 +278,38 @@ int main() {
     print_bench_result<std::chrono::microseconds>(ColumnIterator_bench_data, "col rand access, write to single col cells");
 #endif
 
+#ifdef COL_MAJOR_BENCH
+    std::cout << "\n  col access, column major layout, iterations: " << COUNT__ITER_COL_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_COL_BENCH> ColumnMajor_bench_data;
+
+    DataFrame<dataT> col_major_df{bench_col_names, bench_row_names, Layout::ColumnMajor};
+
+    for (std::size_t i = 0; i < COUNT__ITER_COL_BENCH; i++) {
+        std::size_t col_count = col_major_df.shape().col_count;
+        nsec_timer.tick();
+        for (auto col = col_major_df.iter_cols(); col.current_col_idx() < col_count; col++) {
+            for (auto& c : col.current_col()) {
+                c = 456456.456;
+            }
+        }
+        nsec_timer.tock();
+        ColumnMajor_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::milliseconds>(ColumnMajor_bench_data, "iter_col(), write to all cells");
+
+    for (std::size_t i = 0; i < COUNT__ITER_COL_BENCH; i++) {
+        std::size_t rand_idx = static_cast<std::size_t>(rand()) % (col_major_df.shape().col_count - 1);
+        nsec_timer.tick();
+        auto col = col_major_df.column(rand_idx);
+        for (auto& c : col) {
+            auto v __attribute__((unused)) = c;
+        }
+        nsec_timer.tock();
+        ColumnMajor_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::nanoseconds>(ColumnMajor_bench_data, "col rand access, read single col cell values");
+#endif
+
     // #ifdef SORT_BENCH
     //     std::cout << "\n  sort, test iterations: " << COUNT__ITER_SORT_BENCH << "\n";
     //     std::array<std::chrono::nanoseconds, COUNT__ITER_SORT_BENCH> sort_bench_data;
@@ -272,6 +346,32 @@ int main() {
     print_bench_result<std::chrono::microseconds>(row_sort_bench_data, "sort(col_name, true), sort df by col, sort df rows by col value");
 #endif
 
+#ifdef PAR_SORT_BENCH
+    std::cout << "\n  parallel sort, rows: " << PAR_SORT_BENCH_ROW_COUNT << ", iterations: " << COUNT__ITER_PAR_SORT_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_PAR_SORT_BENCH> par_sort_bench_data;
+
+    std::vector<std ::string> tall_row_names{};
+    for (std::size_t i = 0; i < PAR_SORT_BENCH_ROW_COUNT; i++) {
+        tall_row_names.push_back(std::string{"row-" + std::to_string(i)});
+    }
+    DataFrame<dataT> tall_df{{"key", "value"}, tall_row_names, Layout::ColumnMajor};
+    for (std::size_t i = 0; i < tall_df.size(); ++i) {
+        tall_df[i] = static_cast<dataT>(static_cast<std::size_t>(rand()) % tall_df.size());
+    }
+
+    for (std::size_t threads = 1; threads <= resolve_thread_count(0); threads *= 2) {
+        for (std::size_t i = 0; i < COUNT__ITER_PAR_SORT_BENCH; i++) {
+            auto rows = tall_df.rows();
+            nsec_timer.tick();
+            rows.sort(execution::par.with_threads(threads), "key", true);
+            nsec_timer.tock();
+            par_sort_bench_data[i] = nsec_timer.duration();
+        }
+        std::string bench_name = "sort(par.with_threads(" + std::to_string(threads) + "), col_name, true)";
+        print_bench_result<std::chrono::milliseconds>(par_sort_bench_data, bench_name.c_str());
+    }
+#endif
+
 #ifdef COPY_BENCH
     std::cout << "\n  df copy, test iterations: " << COUNT__ITER_COPY_BENCH << "\n";
     std::array<std::chrono::nanoseconds, COUNT__ITER_COPY_BENCH> row_copy_bench_data;
@@ -283,6 +383,281 @@ int main() {
         row_copy_bench_data[i] = nsec_timer.duration();
     }
     print_bench_result<std::chrono::milliseconds>(row_copy_bench_data, "DataFrame<T>::DataFrame(const DataFrame<T>& other): copy constructor");
+
+    for (std::size_t i = 0; i < COUNT__ITER_COPY_BENCH; i++) {
+        nsec_timer.tick();
+        DataFrame<dataT> new_df = df.copy(execution::par);
+        nsec_timer.tock();
+        row_copy_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::milliseconds>(row_copy_bench_data, "DataFrame<T>::copy(execution::par)");
+#endif
+
+#ifdef MOVE_BENCH
+    std::cout << "\n  move semantics, iterations: " << COUNT__ITER_MOVE_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_MOVE_BENCH> move_bench_data;
+    AllocCounter                                                 alloc_counter;
+
+    Series<dataT> a = df.column(0).to_series();
+    Series<dataT> b = df.column(1).to_series();
+    Series<dataT> c = df.column(2).to_series();
+    Series<dataT> d = df.column(3).to_series();
+
+    std::size_t expr_allocs = 0;
+    for (std::size_t i = 0; i < COUNT__ITER_MOVE_BENCH; i++) {
+        alloc_counter.reset();
+        nsec_timer.tick();
+        Series<dataT> result = a * b + c - d;
+        nsec_timer.tock();
+        expr_allocs        = alloc_counter.count();
+        move_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::microseconds>(move_bench_data, "Series a * b + c - d, fused expression");
+    std::cout << "    allocations per expression: " << expr_allocs << " (the result only)\n";
+
+    Series<dataT> out(a.size());
+    for (std::size_t i = 0; i < COUNT__ITER_MOVE_BENCH; i++) {
+        alloc_counter.reset();
+        nsec_timer.tick();
+        out = a * b + c - d;
+        nsec_timer.tock();
+        expr_allocs        = alloc_counter.count();
+        move_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::microseconds>(move_bench_data, "out = a * b + c - d, into an existing series");
+    std::cout << "    allocations per expression: " << expr_allocs << "\n";
+
+    std::size_t frame_allocs = 0;
+    for (std::size_t i = 0; i < COUNT__ITER_MOVE_BENCH; i++) {
+        DataFrame<dataT> returned = make_frame<dataT>(bench_col_names, bench_row_names);
+        alloc_counter.reset();
+        nsec_timer.tick();
+        DataFrame<dataT> moved{std::move(returned)};
+        returned = std::move(moved);
+        nsec_timer.tock();
+        frame_allocs       = alloc_counter.count();
+        move_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::nanoseconds>(move_bench_data, "DataFrame move construct + move assign");
+    std::cout << "    allocations per move: " << frame_allocs << "\n";
+#endif
+
+#ifdef SIMD_BENCH
+    std::cout << "\n  simd kernels, elements: " << SIMD_BENCH_SIZE << ", iterations: " << COUNT__ITER_SIMD_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_SIMD_BENCH> simd_bench_data;
+
+    Series<dataT>            lhs(SIMD_BENCH_SIZE);
+    Series<dataT>            rhs(SIMD_BENCH_SIZE);
+    Series<dataT>            res(SIMD_BENCH_SIZE);
+    Series<bool>             cmp(SIMD_BENCH_SIZE);
+    Mask                     mask(SIMD_BENCH_SIZE);
+    Mask                     other_mask(SIMD_BENCH_SIZE, true);
+    std::vector<std::size_t> selection;
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        lhs[i] = static_cast<dataT>(rand() % 1000);
+        rhs[i] = static_cast<dataT>(rand() % 1000 + 1);
+    }
+
+    constexpr std::size_t elem = sizeof(dataT);
+    for (simd::Level level : {simd::Level::Scalar, simd::Level::SSE42, simd::Level::AVX2, simd::Level::AVX512}) {
+        if (level > simd::detect_level()) { continue; }
+        simd::set_level(level);
+        std::cout << "   " << simd::level_name(level) << "\n";
+
+        auto run = [&](auto&& kernel, std::size_t bytes, const char* bench_name) {
+            for (std::size_t i = 0; i < COUNT__ITER_SIMD_BENCH; i++) {
+                nsec_timer.tick();
+                kernel();
+                nsec_timer.tock();
+                simd_bench_data[i] = nsec_timer.duration();
+            }
+            print_bandwidth_result(simd_bench_data, bytes, bench_name);
+        };
+
+        run([&] { res = lhs + rhs; }, 3 * elem * SIMD_BENCH_SIZE, "res = lhs + rhs");
+        run([&] { res = lhs * rhs; }, 3 * elem * SIMD_BENCH_SIZE, "res = lhs * rhs");
+        run([&] { res = lhs / rhs; }, 3 * elem * SIMD_BENCH_SIZE, "res = lhs / rhs");
+        run([&] { res = lhs * 2.0; }, 2 * elem * SIMD_BENCH_SIZE, "res = lhs * scalar");
+        run([&] { res += lhs; }, 3 * elem * SIMD_BENCH_SIZE, "res += lhs, in place");
+        run([&] { res *= 1.0; }, 2 * elem * SIMD_BENCH_SIZE, "res *= scalar, in place");
+        run([&] { cmp = lhs < rhs; }, (2 * elem + 1) * SIMD_BENCH_SIZE, "cmp = lhs < rhs");
+        run([&] { mask = lhs < rhs; }, 2 * elem * SIMD_BENCH_SIZE + SIMD_BENCH_SIZE / 8, "Mask mask = lhs < rhs");
+        run([&] { mask &= other_mask; }, 3 * SIMD_BENCH_SIZE / 8, "mask &= other_mask");
+        mask = lhs < rhs;
+        run([&] { selection = mask.indices(); }, SIMD_BENCH_SIZE / 8 + sizeof(std::size_t) * mask.count(), "selection = mask.indices()");
+        run([&] { res[0] = lhs.max(); }, elem * SIMD_BENCH_SIZE, "lhs.max()");
+        run([&] { res[0] = lhs.min(); }, elem * SIMD_BENCH_SIZE, "lhs.min()");
+        run([&] { fill_series(res, dataT{1}); }, elem * SIMD_BENCH_SIZE, "fill_series(res, value)");
+        run([&] { res[0] = lhs.sum(Summation::Naive); }, elem * SIMD_BENCH_SIZE, "lhs.sum(Naive)");
+        run([&] { res[0] = lhs.sum(Summation::Pairwise); }, elem * SIMD_BENCH_SIZE, "lhs.sum(Pairwise)");
+        run([&] { res[0] = lhs.sum(Summation::Kahan); }, elem * SIMD_BENCH_SIZE, "lhs.sum(Kahan)");
+        run([&] { res[0] = static_cast<dataT>(lhs.var()); }, 2 * elem * SIMD_BENCH_SIZE, "lhs.var()");
+    }
+    simd::set_level(simd::detect_level());
+#endif
+
+#ifdef ALGO_BENCH
+    std::cout << "\n  df_algo over the whole frame, iterations: " << COUNT__ITER_ALGO_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_ALGO_BENCH> algo_bench_data;
+
+    auto run_algo = [&](auto&& algo, const std::string& bench_name) {
+        for (std::size_t i = 0; i < COUNT__ITER_ALGO_BENCH; i++) {
+            nsec_timer.tick();
+            algo();
+            nsec_timer.tock();
+            algo_bench_data[i] = nsec_timer.duration();
+        }
+        print_bench_result<std::chrono::milliseconds>(algo_bench_data, bench_name.c_str());
+    };
+
+    DataFrame<dataT> algo_other = df.copy(execution::par);
+    std::size_t      matches    = 0;
+    run_algo(
+    [&] {
+        for (auto& c : df) {
+            c = dataT{2};
+        }
+    },
+    "serial loop, fill");
+    run_algo(
+    [&] {
+        for (auto& c : df) {
+            c = c * dataT{2};
+        }
+    },
+    "serial loop, transform");
+    run_algo(
+    [&] {
+        matches = 0;
+        for (auto& c : df) {
+            matches += static_cast<std::size_t>(c > dataT{100});
+        }
+    },
+    "serial loop, count_if");
+
+    auto run_policy = [&](auto policy, const std::string& policy_name) {
+        run_algo([&] { fill(policy, df, dataT{2}); }, "fill(" + policy_name + ")");
+        run_algo([&] { transform(policy, df, [](dataT value) { return value * dataT{2}; }); }, "transform(" + policy_name + ")");
+        run_algo([&] { zip_transform(policy, df, algo_other, df, [](dataT lhs, dataT rhs) { return lhs + rhs; }); }, "zip_transform(" + policy_name + ")");
+        run_algo([&] { matches = count_if(policy, df, [](dataT value) { return value > dataT{100}; }); }, "count_if(" + policy_name + ")");
+        run_algo([&] { replace_if(policy, df, [](dataT value) { return value > dataT{100}; }, dataT{0}); }, "replace_if(" + policy_name + ")");
+    };
+    run_policy(execution::seq, "seq");
+    run_policy(execution::par, "par");
+    run_policy(execution::par_unseq, "par_unseq");
+
+    Series<dataT> column_sums(df.col_count());
+    run_algo([&] { column_sums = df.sum(); }, "df.sum(), column by column");
+    run_algo([&] { column_sums = df.sum(execution::seq); }, "df.sum(seq), row blocks");
+    run_algo([&] { column_sums = df.sum(execution::par); }, "df.sum(par), row blocks");
+    run_algo([&] { column_sums = df.max(execution::par); }, "df.max(par), row blocks");
+#endif
+
+#ifdef DESCRIBE_BENCH
+    std::cout << "\n  describe, cols: " << DESCRIBE_BENCH_COL_COUNT << ", rows: " << DESCRIBE_BENCH_ROW_COUNT
+              << ", iterations: " << COUNT__ITER_DESCRIBE_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_DESCRIBE_BENCH> describe_bench_data;
+
+    std::vector<std ::string> describe_col_names{};
+    for (std::size_t i = 0; i < DESCRIBE_BENCH_COL_COUNT; i++) {
+        describe_col_names.push_back(std::string{"col-" + std::to_string(i)});
+    }
+    std::vector<std ::string> describe_row_names{};
+    for (std::size_t i = 0; i < DESCRIBE_BENCH_ROW_COUNT; i++) {
+        describe_row_names.push_back(std::string{"row-" + std::to_string(i)});
+    }
+
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<dataT> describe_df{describe_col_names, describe_row_names, layout};
+        for (std::size_t i = 0; i < describe_df.size(); ++i) {
+            describe_df[i] = static_cast<dataT>(rand() % 1000);
+        }
+        std::string layout_name = layout == Layout::RowMajor ? "row major, " : "column major, ";
+
+        for (std::size_t i = 0; i < COUNT__ITER_DESCRIBE_BENCH; i++) {
+            nsec_timer.tick();
+            for (std::size_t col_idx = 0; col_idx < describe_df.col_count(); col_idx++) {
+                auto col                        = describe_df.column(col_idx);
+                auto v __attribute__((unused)) = col.mean() + col.std() + col.min() + col.max();
+            }
+            nsec_timer.tock();
+            describe_bench_data[i] = nsec_timer.duration();
+        }
+        print_bench_result<std::chrono::milliseconds>(describe_bench_data, (layout_name + "mean/std/min/max, a pass per stat per column").c_str());
+
+        for (std::size_t i = 0; i < COUNT__ITER_DESCRIBE_BENCH; i++) {
+            nsec_timer.tick();
+            auto stats __attribute__((unused)) = describe_df.describe();
+            nsec_timer.tock();
+            describe_bench_data[i] = nsec_timer.duration();
+        }
+        print_bench_result<std::chrono::milliseconds>(describe_bench_data, (layout_name + "describe(), stats and quartiles").c_str());
+
+        for (std::size_t i = 0; i < COUNT__ITER_DESCRIBE_BENCH; i++) {
+            nsec_timer.tick();
+            auto stats __attribute__((unused)) = describe_df.describe(execution::par);
+            nsec_timer.tock();
+            describe_bench_data[i] = nsec_timer.duration();
+        }
+        print_bench_result<std::chrono::milliseconds>(describe_bench_data, (layout_name + "describe(par), stats and quartiles").c_str());
+    }
+#endif
+
+#ifdef CHUNKED_BENCH
+    std::cout << "\n  chunked storage, cols: " << DESCRIBE_BENCH_COL_COUNT << ", rows: " << CHUNKED_BENCH_ROW_COUNT
+              << ", iterations: " << COUNT__ITER_CHUNKED_BENCH << "\n";
+    std::array<std::chrono::nanoseconds, COUNT__ITER_CHUNKED_BENCH> chunked_bench_data;
+
+    std::vector<std ::string> chunked_col_names{};
+    for (std::size_t i = 0; i < DESCRIBE_BENCH_COL_COUNT; i++) {
+        chunked_col_names.push_back(std::string{"col-" + std::to_string(i)});
+    }
+    std::vector<std ::string> chunked_row_names{};
+    for (std::size_t i = 0; i < CHUNKED_BENCH_ROW_COUNT; i++) {
+        chunked_row_names.push_back(std::string{"row-" + std::to_string(i)});
+    }
+    std::vector<dataT> chunked_row(DESCRIBE_BENCH_COL_COUNT, dataT{1});
+
+    for (std::size_t i = 0; i < COUNT__ITER_CHUNKED_BENCH; i++) {
+        DataFrame<dataT> dense{chunked_col_names, {}};
+        nsec_timer.tick();
+        for (const auto& row_name : chunked_row_names) {
+            dense.append_row(row_name, chunked_row);
+        }
+        nsec_timer.tock();
+        chunked_bench_data[i] = nsec_timer.duration();
+    }
+    print_bench_result<std::chrono::milliseconds>(chunked_bench_data, "DataFrame::append_row, row by row");
+
+    ChunkedDataFrame<dataT> chunked{chunked_col_names};
+    for (std::size_t i = 0; i < COUNT__ITER_CHUNKED_BENCH; i++) {
+        ChunkedDataFrame<dataT> ingest{chunked_col_names};
+        nsec_timer.tick();
+        for (const auto& row_name : chunked_row_names) {
+            ingest.append_row(row_name, chunked_row);
+        }
+        nsec_timer.tock();
+        chunked_bench_data[i] = nsec_timer.duration();
+        chunked               = std::move(ingest);
+    }
+    print_bench_result<std::chrono::milliseconds>(chunked_bench_data, "ChunkedDataFrame::append_row, row by row");
+
+    auto run_chunked = [&](auto&& run, const char* bench_name) {
+        for (std::size_t i = 0; i < COUNT__ITER_CHUNKED_BENCH; i++) {
+            nsec_timer.tick();
+            run();
+            nsec_timer.tock();
+            chunked_bench_data[i] = nsec_timer.duration();
+        }
+        print_bench_result<std::chrono::milliseconds>(chunked_bench_data, bench_name);
+    };
+
+    DataFrame<dataT> chunked_dense = chunked.to_dataframe();
+    Series<dataT>    chunked_sums(DESCRIBE_BENCH_COL_COUNT);
+    run_chunked([&] { chunked_sums = chunked_dense.sum(execution::seq); }, "DataFrame::sum(seq), column major");
+    run_chunked([&] { chunked_sums = chunked_dense.sum(execution::par); }, "DataFrame::sum(par), column major");
+    run_chunked([&] { chunked_sums = chunked.sum(execution::seq); }, "ChunkedDataFrame::sum(seq)");
+    run_chunked([&] { chunked_sums = chunked.sum(execution::par); }, "ChunkedDataFrame::sum(par)");
 #endif
     return 0;
 }
@@ -27,9 +27,9 @@ int main() {
     // const_df[1,1] = 123;
     for (auto col_iter = const_df.iter_cols(); col_iter < const_df.end(); ++col_iter) {
         if (col_iter.current_col().index() == 1) {
-            // col_iter.current_col()[0]->value = 123;
+            // col_iter.current_col()[0] = 123;
             for (auto& c : col_iter.current_col()) {
-                // c->value = 456;
+                // c = 456;
             }
 
             auto d = col_iter.current_col().to_series();
@@ -42,9 +42,9 @@ int main() {
 
     for (auto row_iter = const_df.iter_rows(); row_iter < const_df.end(); ++row_iter) {
         if (row_iter.current_row().index() == 1) {
-            // col_iter.current_col()[0]->value = 123;
+            // row_iter.current_row()[0] = 123;
             for (auto& r : row_iter.current_row()) {
-                // r->value = 456;
+                // r = 456;
             }
 
             auto d = row_iter.current_row().to_series();
@@ -57,8 +57,8 @@ int main() {
 
     for (auto col_iter = df.iter_cols(); col_iter < df.end(); ++col_iter) {
         if (col_iter.current_col().index() == 1) {
-            for (const auto& c : col_iter.current_col()) {
-                c->value = 456;
+            for (auto& c : col_iter.current_col()) {
+                c = 456;
             }
 
             auto d = col_iter.current_col().to_series();
@@ -72,10 +72,10 @@ int main() {
 
     for (auto row_iter = df.iter_rows(); row_iter < df.end(); row_iter++) {
         if (row_iter.current_row().index() == 1) {
-            for (const auto& c : row_iter.current_row()) {
-                c->value = 123;
+            for (auto& c : row_iter.current_row()) {
+                c = 123;
             }
-            // i.row()[0]->value = 123;
+            // i.row()[0] = 123;
             auto d = row_iter.current_row().to_series();
             for (std::size_t i = 0; i < d.size(); i++) {
                 std::cout << d[i] << ", ";
@@ -7,10 +7,14 @@
 #include "df_cell.hpp"
 #include "df_column_iterator.hpp"
 #include "df_column_view.hpp"
+#include "df_label_index.hpp"
 #include "df_logger.hpp"
+#include "df_mask.hpp"
+#include "df_parallel.hpp"
 #include "df_row_group_view.hpp"
 #include "df_row_iterator.hpp"
 #include "df_row_view.hpp"
+#include "df_sort.hpp"
 
 namespace df {
 
@@ -29,8 +33,8 @@ namespace df {
 
       public:
         using data_type        = T;
-        using value_type       = Cell<data_type>;
-        using const_value_type = const Cell<data_type>;
+        using value_type       = data_type;
+        using const_value_type = const data_type;
 
         using iterator       = BaseIterator<DataFrame<data_type>, false>;
         using const_iterator = BaseIterator<DataFrame<data_type>, true>;
@@ -51,118 +55,187 @@ namespace df {
             : logger(this),
               logging_context({}),
               m_current_size(0),
+              m_capacity(0),
               m_col_size(0),
               m_col_count(0),
               m_row_size(0),
               m_row_count(0),
+              m_layout(Layout::RowMajor),
+              m_col_stride(0),
+              m_row_stride(0),
               m_d(nullptr) {
         }
 
-        DataFrame(const std::vector<std ::string>& col_names, const std::vector<std::string>& row_names) : logger(this), logging_context({}) {
+        DataFrame(const std::vector<std ::string>& col_names, const std::vector<std::string>& row_names, Layout layout = Layout::RowMajor)
+            : logger(this),
+              logging_context({}) {
             m_col_count    = static_cast<std::size_t>(col_names.size());
             m_row_count    = static_cast<std::size_t>(row_names.size());
             m_col_size     = m_row_count;
             m_row_size     = m_col_count;
             m_current_size = m_col_count * m_row_count;
-            m_d            = new value_type[m_current_size];
-
-            for (std::size_t i = 0; i < m_col_count; i++) {
-                m_col_idx_map.insert({col_names[i], i});
-                if (col_names[i].size() > logging_context.max_col_name_size) { logging_context.max_col_name_size = col_names[i].size(); }
-            }
-
-            for (std::size_t i = 0; i < m_row_count; i++) {
-                m_row_idx_map.insert({row_names[i], i});
-                if (row_names[i].size() > logging_context.max_row_name_size) { logging_context.max_row_name_size = row_names[i].size(); }
-            }
-
-            // 00 01 02 03 04
-            // 05 06 07 08 09
-            // 10 11 12 13 14
-            // 15 16 17 18 19
+            m_capacity     = m_current_size;
+            set_layout(layout);
+            m_d = new value_type[m_capacity];
+
+            m_col_labels                      = LabelIndex(col_names);
+            m_row_labels                      = LabelIndex(row_names);
+            logging_context.max_col_name_size = m_col_labels.max_name_size();
+            logging_context.max_row_name_size = m_row_labels.max_name_size();
+
+            // the buffer holds values only, the index of a cell is derived from its position, see index_of().
+            // row major:       column major:
+            // 00 01 02 03 04   00 04 08 12 16
+            // 05 06 07 08 09   01 05 09 13 17
+            // 10 11 12 13 14   02 06 10 14 18
+            // 15 16 17 18 19   03 07 11 15 19
 
             // 00 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15 16 17 18 19
 
-            for (std::size_t i = 0; i < m_current_size; i++) {
-                m_d[i].idx.global_idx = i;
-
-                m_d[i].idx.col_idx  = i % m_col_count;
-                m_d[i].idx.col_name = col_names[i % m_col_count];
-
-                m_d[i].idx.row_idx  = i / m_col_count;
-                m_d[i].idx.row_name = row_names[i / m_col_count];
-            }
+            logger.with_context(logging_context);
+        }
 
+        // a frame over a buffer it does not allocate, buffer holds the values in layout order and stays alive as long as
+        // buffer_owner does. the frame keeps buffer_owner until it is destroyed or its buffer has to grow, then the values
+        // move to a buffer of its own. see open_mapped_file().
+        DataFrame(const std::vector<std ::string>& col_names,
+                  const std::vector<std::string>&  row_names,
+                  Layout                           layout,
+                  value_type*                      buffer,
+                  std::shared_ptr<void>            buffer_owner)
+            : logger(this),
+              logging_context({}) {
+            m_col_count    = static_cast<std::size_t>(col_names.size());
+            m_row_count    = static_cast<std::size_t>(row_names.size());
+            m_col_size     = m_row_count;
+            m_row_size     = m_col_count;
+            m_current_size = m_col_count * m_row_count;
+            m_capacity     = m_current_size;
+            set_layout(layout);
+            m_d            = buffer;
+            m_buffer_owner = std::move(buffer_owner);
+
+            m_col_labels                      = LabelIndex(col_names);
+            m_row_labels                      = LabelIndex(row_names);
+            logging_context.max_col_name_size = m_col_labels.max_name_size();
+            logging_context.max_row_name_size = m_row_labels.max_name_size();
             logger.with_context(logging_context);
         }
 
-        DataFrame(const RowGroupView<row_type>& rows) : logger(this), logging_context({}) {
+        // gathers the rows of a view into a new frame, the view may be on a const frame.
+        template<typename Row>
+            requires(std::is_same_v<Row, row_type> || std::is_same_v<Row, const_row_type>)
+        DataFrame(const RowGroupView<Row>& rows, Layout layout = Layout::RowMajor) : logger(this), logging_context({}) {
             m_col_count    = rows.row_size();
             m_row_count    = rows.size();
             m_col_size     = m_row_count;
             m_row_size     = m_col_count;
             m_current_size = m_col_count * m_row_count;
-            m_d            = new value_type[m_current_size];
-
-            std::size_t idx = 0;
-            for (std::size_t row_idx = 0; row_idx < m_row_count; row_idx++) {
-                for (std::size_t i = 0; i < m_col_count; i++) {
-                    m_d[idx] = rows[row_idx][i];
-                    idx++;
+            m_capacity     = m_current_size;
+            set_layout(layout);
+            m_d = new value_type[m_capacity];
+
+            // gather column by column, the source rows are read in permutation order.
+            const DataFrame& src = *rows.dataframe();
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                const_column_type src_col = src.column(col_idx);
+                column_type       dst_col = column(col_idx);
+                for (std::size_t row_idx = 0; row_idx < m_row_count; row_idx++) {
+                    dst_col[row_idx] = src_col[rows.row_index(row_idx)];
                 }
             }
-
-            for (std::size_t i = 0; i < m_col_count; i++) {
-                m_col_idx_map.insert({m_d[i].idx.col_name, i});
-                if (m_d[i].idx.col_name.size() > logging_context.max_col_name_size) {
-                    logging_context.max_col_name_size = m_d[i].idx.col_name.size();
+            for (std::size_t col_idx = 0; col_idx < src.m_validity.size(); col_idx++) {
+                if (const Mask* src_valid = src.validity(col_idx)) {
+                    Mask valid(m_row_count);
+                    for (std::size_t row_idx = 0; row_idx < m_row_count; row_idx++) {
+                        valid.set(row_idx, (*src_valid)[rows.row_index(row_idx)]);
+                    }
+                    set_validity(col_idx, std::move(valid));
                 }
             }
 
-            for (std::size_t i = 0; i < m_current_size; i += m_row_size) {
-                m_row_idx_map.insert({m_d[i].idx.row_name, i});
-                if (m_d[i].idx.row_name.size() > logging_context.max_row_name_size) {
-                    logging_context.max_row_name_size = m_d[i].idx.row_name.size();
-                }
+            m_col_labels = rows.dataframe()->col_labels();
+            m_row_labels.reserve(m_row_count);
+            for (std::size_t i = 0; i < m_row_count; i++) {
+                m_row_labels.push_back(src.get_row_name(rows.row_index(i)));
             }
+            logging_context.max_col_name_size = m_col_labels.max_name_size();
+            logging_context.max_row_name_size = m_row_labels.max_name_size();
 
             logger.with_context(logging_context);
         }
 
-        DataFrame(const DataFrame& other)
+        DataFrame(const DataFrame& other) : DataFrame(other, execution::seq) {
+        }
+
+        // copy constructor with the buffer copied under the given policy, in chunks of at least parallel_grain values per thread.
+        template<execution_policy Policy>
+        DataFrame(const DataFrame& other, Policy policy)
             : logger(this),
-              m_col_idx_map(other.m_col_idx_map),
-              m_row_idx_map(other.m_row_idx_map),
+              m_col_labels(other.m_col_labels),
+              m_row_labels(other.m_row_labels),
               m_current_size(other.m_current_size),
+              m_capacity(other.m_current_size),
               m_col_size(other.m_col_size),
               m_col_count(other.m_col_count),
               m_row_size(other.m_row_size),
               m_row_count(other.m_row_count),
-              m_d(new value_type[m_current_size]),
+              m_layout(other.m_layout),
+              m_col_stride(other.m_col_stride),
+              m_row_stride(other.m_row_stride),
+              m_d(new value_type[m_capacity]),
+              m_validity(other.m_validity),
               logging_context(other.logging_context) {
-            for (std::size_t idx = 0; idx < m_current_size; idx++) {
-                m_d[idx] = other.m_d[idx];
-            }
+            parallel_for(policy, 0, m_current_size, [this, &other](std::size_t first, std::size_t last) {
+                std::copy(other.m_d + first, other.m_d + last, m_d + first);
+            });
             logger.with_context(logging_context);
         }
 
+        // takes over the buffer and labels of other, other is left as an empty (is_null()) frame.
+        DataFrame(DataFrame&& other) noexcept
+            : logger(this),
+              m_col_labels(std::move(other.m_col_labels)),
+              m_row_labels(std::move(other.m_row_labels)),
+              m_current_size(other.m_current_size),
+              m_capacity(other.m_capacity),
+              m_col_size(other.m_col_size),
+              m_col_count(other.m_col_count),
+              m_row_size(other.m_row_size),
+              m_row_count(other.m_row_count),
+              m_layout(other.m_layout),
+              m_col_stride(other.m_col_stride),
+              m_row_stride(other.m_row_stride),
+              m_d(other.m_d),
+              m_buffer_owner(std::move(other.m_buffer_owner)),
+              m_validity(std::move(other.m_validity)),
+              logging_context(std::move(other.logging_context)) {
+            logger.context = std::move(other.logger.context);
+            other.release();
+        }
+
         ~DataFrame() {
-            delete[] m_d;
+            free_buffer();
         }
 
         DataFrame& operator=(const DataFrame& other) {
             if (this != &other) {
                 if (is_null()) {
                     FORCED_ASSERT(m_d == nullptr, "m_d supposed to be null pointer, something is wrong");
-                    m_col_idx_map   = other.m_col_idx_map;
-                    m_row_idx_map   = other.m_row_idx_map;
+                    m_col_labels    = other.m_col_labels;
+                    m_row_labels    = other.m_row_labels;
                     m_current_size  = other.m_current_size;
                     m_col_size      = other.m_col_size;
                     m_col_count     = other.m_col_count;
                     m_row_size      = other.m_row_size;
                     m_row_count     = other.m_row_count;
+                    m_layout        = other.m_layout;
+                    m_col_stride    = other.m_col_stride;
+                    m_row_stride    = other.m_row_stride;
                     logging_context = other.logging_context;
-                    m_d             = new value_type[other.m_current_size];
+                    m_validity      = other.m_validity;
+                    m_capacity      = other.m_current_size;
+                    m_d             = new value_type[m_capacity];
                     for (std::size_t idx = 0; idx < m_current_size; idx++) {
                         m_d[idx] = other.m_d[idx];
                     }
@@ -170,14 +243,24 @@ namespace df {
                     FORCED_ASSERT(m_current_size == other.m_current_size,
                                   "Copy assignment operator on DataFrame with other "
                                   "nonmatching size.");
-                    m_col_idx_map   = other.m_col_idx_map;
-                    m_row_idx_map   = other.m_row_idx_map;
+                    m_col_labels    = other.m_col_labels;
+                    m_row_labels    = other.m_row_labels;
                     m_current_size  = other.m_current_size;
                     m_col_size      = other.m_col_size;
                     m_col_count     = other.m_col_count;
                     m_row_size      = other.m_row_size;
                     m_row_count     = other.m_row_count;
+                    m_layout        = other.m_layout;
+                    m_col_stride    = other.m_col_stride;
+                    m_row_stride    = other.m_row_stride;
                     logging_context = other.logging_context;
+                    m_validity      = other.m_validity;
+                    // a frame on an external buffer, e.g. a mapped file, gets a buffer of its own instead of writing into it.
+                    if (m_buffer_owner) {
+                        free_buffer();
+                        m_d        = new value_type[m_current_size];
+                        m_capacity = m_current_size;
+                    }
                     for (std::size_t idx = 0; idx < m_current_size; idx++) {
                         m_d[idx] = other.m_d[idx];
                     }
@@ -186,6 +269,76 @@ namespace df {
             return *this;
         }
 
+        DataFrame& operator=(DataFrame&& other) noexcept {
+            if (this != &other) {
+                free_buffer();
+                m_col_labels    = std::move(other.m_col_labels);
+                m_row_labels    = std::move(other.m_row_labels);
+                m_current_size  = other.m_current_size;
+                m_col_size      = other.m_col_size;
+                m_col_count     = other.m_col_count;
+                m_row_size      = other.m_row_size;
+                m_row_count     = other.m_row_count;
+                m_layout        = other.m_layout;
+                m_col_stride    = other.m_col_stride;
+                m_row_stride    = other.m_row_stride;
+                m_capacity      = other.m_capacity;
+                m_d             = other.m_d;
+                m_buffer_owner  = std::move(other.m_buffer_owner);
+                m_validity      = std::move(other.m_validity);
+                logging_context = std::move(other.logging_context);
+                logger.context  = std::move(other.logger.context);
+                other.release();
+            }
+            return *this;
+        }
+
+        // element-wise compound assignment over the whole buffer in one pass, rhs is a value or a frame of the same shape.
+        // frames of another layout are combined column by column.
+        DataFrame& operator+=(const value_type& rhs) {
+            apply_in_place<std::plus<>>(m_d, m_current_size, 1, rhs);
+            return *this;
+        }
+
+        DataFrame& operator-=(const value_type& rhs) {
+            apply_in_place<std::minus<>>(m_d, m_current_size, 1, rhs);
+            return *this;
+        }
+
+        DataFrame& operator*=(const value_type& rhs) {
+            apply_in_place<std::multiplies<>>(m_d, m_current_size, 1, rhs);
+            return *this;
+        }
+
+        DataFrame& operator/=(const value_type& rhs) {
+            apply_in_place<std::divides<>>(m_d, m_current_size, 1, rhs);
+            return *this;
+        }
+
+        DataFrame& operator+=(const DataFrame& rhs) {
+            return apply_frame<std::plus<>>(rhs);
+        }
+
+        DataFrame& operator-=(const DataFrame& rhs) {
+            return apply_frame<std::minus<>>(rhs);
+        }
+
+        DataFrame& operator*=(const DataFrame& rhs) {
+            return apply_frame<std::multiplies<>>(rhs);
+        }
+
+        DataFrame& operator/=(const DataFrame& rhs) {
+            return apply_frame<std::divides<>>(rhs);
+        }
+
+        DataFrame& operator++() {
+            return *this += value_type{1};
+        }
+
+        DataFrame& operator--() {
+            return *this -= value_type{1};
+        }
+
         value_type& operator[](const std::size_t& idx) {
             return m_d[idx];
         }
@@ -194,68 +347,244 @@ namespace df {
             return m_d[idx];
         }
 
-        column_type operator[](const std::string& col_name) {
+        column_type operator[](std::string_view col_name) {
             return column(col_name);
         }
 
-        column_type operator[](const std::string& col_name) const {
+        const_column_type operator[](std::string_view col_name) const {
             return column(col_name);
         }
 
         value_type& operator[](const std::size_t& col_idx, const std::size_t& row_idx) {
-            if (col_idx >= m_col_size) { throw std::out_of_range("column index out of range"); };
-            if (row_idx >= m_row_size) { throw std::out_of_range("row index out of range"); };
-            return *(m_d + ((m_row_size * row_idx) + col_idx));
+            if (col_idx >= m_col_count) { throw std::out_of_range("column index out of range"); };
+            if (row_idx >= m_row_count) { throw std::out_of_range("row index out of range"); };
+            return *(m_d + offset_of(col_idx, row_idx));
         }
 
         const_value_type& operator[](const std::size_t& col_idx, const std::size_t& row_idx) const {
-            if (col_idx >= m_col_size) { throw std::out_of_range("column index out of range"); };
-            if (row_idx >= m_row_size) { throw std::out_of_range("row index out of range"); };
-            return *(m_d + ((m_row_size * row_idx) + col_idx));
+            if (col_idx >= m_col_count) { throw std::out_of_range("column index out of range"); };
+            if (row_idx >= m_row_count) { throw std::out_of_range("row index out of range"); };
+            return *(m_d + offset_of(col_idx, row_idx));
         }
 
-        value_type& operator[](const std::string& col_name, const std::string& row_name) {
-            if (!m_col_idx_map.contains(col_name) || !m_row_idx_map.contains(row_name)) {
-                throw std::out_of_range("Column/row name not found: " + col_name + "/" + row_name);
-            }
-            std::size_t col_idx = m_col_idx_map[col_name];
-            std::size_t row_idx = m_row_idx_map[row_name];
-            return *(m_d + ((m_row_size * row_idx) + col_idx));
+        value_type& operator[](std::string_view col_name, std::string_view row_name) {
+            return *(m_d + offset_of(col_name, row_name));
         }
 
-        const_value_type& operator[](const std::string& col_name, const std::string& row_name) const {
-            if (!m_col_idx_map.contains(col_name) && !m_row_idx_map.contains(row_name)) {
-                throw std::out_of_range("Column/row name not found: " + col_name + "/" + row_name);
-            }
-            std::size_t col_idx = m_col_idx_map.at(col_name);
-            std::size_t row_idx = m_row_idx_map.at(row_name);
-            return *(m_d + ((m_row_size * row_idx) + col_idx));
+        const_value_type& operator[](std::string_view col_name, std::string_view row_name) const {
+            return *(m_d + offset_of(col_name, row_name));
         }
 
         DataFrame copy() {
             return DataFrame(*this);
         }
 
-        std::size_t get_col_idx(std::string col) const {
-            return m_col_idx_map.at(col);
+        template<execution_policy Policy>
+        DataFrame copy(Policy policy) const {
+            return DataFrame(*this, policy);
+        }
+
+        /*
+         growing and shrinking. the buffer stays dense in layout order and grows geometrically, like a std::vector, so appending
+         along the major axis (rows of a row major frame, columns of a column major frame) is amortized O(values appended).
+         appending along the other axis moves every value to its new position once per call, append such data in batches with
+         append_rows(). views, iterators and pointers into the frame are invalidated by every call that changes the shape.
+        */
+        std::size_t capacity() const {
+            return m_capacity;
+        }
+
+        // makes room for capacity values without changing the shape.
+        void reserve(std::size_t capacity) {
+            if (capacity > m_capacity) { reallocate(capacity); }
+        }
+
+        void shrink_to_fit() {
+            if (m_capacity > m_current_size) { reallocate(m_current_size); }
         }
 
-        std::string get_col_name(std::size_t col_idx) const {
-            for (const auto& [col_name, idx] : m_col_idx_map) {
-                if (idx == col_idx) { return col_name; }
+        void append_row(std::string row_name, std::span<const value_type> values) {
+            std::vector<std::string> row_names;
+            row_names.push_back(std::move(row_name));
+            append_rows(row_names, values);
+        }
+
+        void append_row(std::string row_name, std::initializer_list<value_type> values) {
+            append_row(std::move(row_name), std::span<const value_type>(values.begin(), values.size()));
+        }
+
+        // values holds the new rows one after the other, col_count() values per row.
+        void append_rows(const std::vector<std::string>& row_names, std::span<const value_type> values) {
+            FORCED_ASSERT(values.size() == row_names.size() * m_col_count, "appended rows with a nonmatching value count");
+            std::size_t added = row_names.size();
+            grow(m_current_size + values.size());
+            if (m_layout == Layout::RowMajor) {
+                std::copy(values.begin(), values.end(), m_d + m_current_size);
+            } else {
+                // each column moves to its new offset, the last one first so no column is overwritten before it moved.
+                for (std::size_t col_idx = m_col_count; col_idx-- > 0;) {
+                    value_type* col = m_d + (col_idx * (m_row_count + added));
+                    std::move_backward(m_d + (col_idx * m_row_count), m_d + ((col_idx + 1) * m_row_count), col + m_row_count);
+                    for (std::size_t row_idx = 0; row_idx < added; row_idx++) {
+                        col[m_row_count + row_idx] = values[(row_idx * m_col_count) + col_idx];
+                    }
+                }
+            }
+            for (const auto& row_name : row_names) {
+                m_row_labels.push_back(row_name);
+            }
+            for (auto& valid : m_validity) {
+                if (valid) { valid->resize(m_row_count + added, true); }
+            }
+            reshape(m_col_count, m_row_count + added);
+        }
+
+        void append_column(std::string col_name, std::span<const value_type> values) {
+            FORCED_ASSERT(values.size() == m_row_count, "appended column with a nonmatching value count");
+            grow(m_current_size + values.size());
+            if (m_layout == Layout::ColumnMajor) {
+                std::copy(values.begin(), values.end(), m_d + m_current_size);
+            } else {
+                // each row moves to its new offset, the last one first.
+                for (std::size_t row_idx = m_row_count; row_idx-- > 0;) {
+                    value_type* row = m_d + (row_idx * (m_col_count + 1));
+                    std::move_backward(m_d + (row_idx * m_col_count), m_d + ((row_idx + 1) * m_col_count), row + m_col_count);
+                    row[m_col_count] = values[row_idx];
+                }
             }
-            throw std::runtime_error("Column index not found: " + std::to_string(col_idx));
+            m_col_labels.push_back(std::move(col_name));
+            if (!m_validity.empty()) { m_validity.emplace_back(); }
+            reshape(m_col_count + 1, m_row_count);
+        }
+
+        void append_column(std::string col_name, std::initializer_list<value_type> values) {
+            append_column(std::move(col_name), std::span<const value_type>(values.begin(), values.size()));
+        }
+
+        // removes the given rows, the remaining rows keep their order. the capacity is kept, see shrink_to_fit().
+        void drop_rows(const std::vector<std::size_t>& rows) {
+            std::vector<bool> keep = keep_mask(rows, m_row_count);
+            compact(keep, std::vector<bool>(m_col_count, true));
+        }
+
+        void drop_rows(const std::vector<std::string>& row_names) {
+            drop_rows(positions_of(m_row_labels, row_names));
         }
 
-        std::size_t get_row_idx(std::string row) const {
-            return m_row_idx_map.at(row);
+        void drop_columns(const std::vector<std::size_t>& cols) {
+            std::vector<bool> keep = keep_mask(cols, m_col_count);
+            compact(std::vector<bool>(m_row_count, true), keep);
         }
 
-        std::string get_row_name(std::size_t row_idx) const {
-            for (const auto& [row_name, idx] : m_row_idx_map) {
-                if (idx == row_idx) { return row_name; }
+        void drop_columns(const std::vector<std::string>& col_names) {
+            drop_columns(positions_of(m_col_labels, col_names));
+        }
+
+        /*
+         validity. every cell is valid until set_null(), the first null of a column gives that column a bitmap, a Mask with a bit per
+         row. columns without one run the dense kernels unchanged, and the reductions and sorts of a column with one skip its nulls,
+         see df_reduce.hpp and sort_rows_with_nulls(). the bitmaps follow the rows and columns through copies, appends, drops and
+         take()/filter()/sort() gathers. the element-wise operators on whole frames ignore them.
+        */
+        bool is_valid(std::size_t col_idx, std::size_t row_idx) const {
+            const Mask* valid = validity(col_idx);
+            return valid == nullptr || (*valid)[row_idx];
+        }
+
+        bool is_valid(std::string_view col_name, std::string_view row_name) const {
+            return is_valid(get_col_idx(col_name), get_row_idx(row_name));
+        }
+
+        void set_null(std::size_t col_idx, std::size_t row_idx) {
+            FORCED_ASSERT(col_idx < m_col_count && row_idx < m_row_count, "set_null out of range");
+            if (m_validity.empty()) { m_validity.resize(m_col_count); }
+            if (!m_validity[col_idx]) { m_validity[col_idx].emplace(m_row_count, true); }
+            m_validity[col_idx]->set(row_idx, false);
+        }
+
+        void set_null(std::string_view col_name, std::string_view row_name) {
+            set_null(get_col_idx(col_name), get_row_idx(row_name));
+        }
+
+        void set_valid(std::size_t col_idx, std::size_t row_idx) {
+            if (col_idx < m_validity.size() && m_validity[col_idx]) { m_validity[col_idx]->set(row_idx, true); }
+        }
+
+        // replaces the bitmap of a column, an empty one marks every cell of the column valid.
+        void set_validity(std::size_t col_idx, std::optional<Mask> valid) {
+            FORCED_ASSERT(!valid || valid->size() == m_row_count, "validity bitmap of nonmatching size");
+            if (m_validity.empty()) {
+                if (!valid) { return; }
+                m_validity.resize(m_col_count);
             }
-            throw std::runtime_error("Row index not found: " + std::to_string(row_idx));
+            m_validity[col_idx] = std::move(valid);
+        }
+
+        // nullptr when every cell of the column is valid.
+        const Mask* validity(std::size_t col_idx) const {
+            return col_idx < m_validity.size() && m_validity[col_idx] ? &*m_validity[col_idx] : nullptr;
+        }
+
+        bool has_nulls() const {
+            return std::any_of(m_validity.begin(), m_validity.end(), [](const std::optional<Mask>& valid) { return valid && !valid->all(); });
+        }
+
+        Series<std::size_t> null_count() const {
+            return reduce_columns<std::size_t>([](const const_column_type& col) { return col.null_count(); });
+        }
+
+        // derives the index of the cell stored at position global_idx of the frame buffer.
+        Index index_of(std::size_t global_idx) const {
+            Index idx;
+            idx.global_idx = global_idx;
+            if (m_layout == Layout::RowMajor) {
+                idx.row_idx = global_idx / m_col_stride;
+                idx.col_idx = global_idx % m_col_stride;
+            } else {
+                idx.col_idx = global_idx / m_row_stride;
+                idx.row_idx = global_idx % m_row_stride;
+            }
+            idx.col_name = get_col_name(idx.col_idx);
+            idx.row_name = get_row_name(idx.row_idx);
+            return idx;
+        }
+
+        Index index_of(std::size_t col_idx, std::size_t row_idx) const {
+            return index_of(offset_of(col_idx, row_idx));
+        }
+
+        // snapshot of a single cell value together with its derived index.
+        Cell<data_type> cell(std::size_t col_idx, std::size_t row_idx) const {
+            Cell<data_type> c;
+            c.value = (*this)[col_idx, row_idx];
+            c.idx   = index_of(col_idx, row_idx);
+            return c;
+        }
+
+        std::size_t get_col_idx(std::string_view col) const {
+            return m_col_labels.at(col);
+        }
+
+        const std::string& get_col_name(std::size_t col_idx) const {
+            if (col_idx >= m_col_labels.size()) { throw std::runtime_error("Column index not found: " + std::to_string(col_idx)); }
+            return m_col_labels.name(col_idx);
+        }
+
+        std::size_t get_row_idx(std::string_view row) const {
+            return m_row_labels.at(row);
+        }
+
+        const std::string& get_row_name(std::size_t row_idx) const {
+            if (row_idx >= m_row_labels.size()) { throw std::runtime_error("Row index not found: " + std::to_string(row_idx)); }
+            return m_row_labels.name(row_idx);
+        }
+
+        const LabelIndex& col_labels() const {
+            return m_col_labels;
+        }
+
+        const LabelIndex& row_labels() const {
+            return m_row_labels;
         }
 
         value_type& at(std::size_t idx) {
@@ -270,6 +599,15 @@ namespace df {
             return m_current_size;
         }
 
+        // the value buffer in layout order, size() values.
+        value_type* data() {
+            return m_d;
+        }
+
+        const_value_type* data() const {
+            return m_d;
+        }
+
         std::size_t col_size() const {
             return m_col_size;
         }
@@ -290,36 +628,50 @@ namespace df {
             return {.col_count = m_col_count, .row_count = m_row_count};
         }
 
+        Layout layout() const {
+            return m_layout;
+        }
+
+        // distance, in cells, between two consecutive cells of the same column
+        std::size_t col_stride() const {
+            return m_col_stride;
+        }
+
+        // distance, in cells, between two consecutive cells of the same row
+        std::size_t row_stride() const {
+            return m_row_stride;
+        }
+
         column_type column(std::size_t col_idx) {
-            return {begin() + col_idx, m_col_size, m_row_size};
+            return {begin() + (col_idx * m_row_stride), m_col_size, m_col_stride, col_idx, this};
         }
 
         const_column_type column(std::size_t col_idx) const {
-            return {begin() + col_idx, m_col_size, m_row_size};
+            return {begin() + (col_idx * m_row_stride), m_col_size, m_col_stride, col_idx, this};
         }
 
-        column_type column(std::string col_name) {
-            return {begin() + get_col_idx(col_name), m_col_size, m_row_size};
+        column_type column(std::string_view col_name) {
+            return column(get_col_idx(col_name));
         }
 
-        const_column_type column(std::string col_name) const {
-            return {begin() + get_col_idx(col_name), m_col_size, m_row_size};
+        const_column_type column(std::string_view col_name) const {
+            return column(get_col_idx(col_name));
         }
 
         row_type row(std::size_t row_idx) {
-            return {begin(), row_idx, m_row_size};
+            return {begin() + (row_idx * m_col_stride), m_row_size, m_row_stride, row_idx, this};
         }
 
         const_row_type row(std::size_t row_idx) const {
-            return {begin(), row_idx, m_row_size};
+            return {begin() + (row_idx * m_col_stride), m_row_size, m_row_stride, row_idx, this};
         }
 
-        row_type row(std::string row_name) {
-            return {begin(), get_row_idx(row_name), m_row_size};
+        row_type row(std::string_view row_name) {
+            return row(get_row_idx(row_name));
         }
 
-        const_row_type row(std::string row_name) const {
-            return {begin(), get_row_idx(row_name), m_row_size};
+        const_row_type row(std::string_view row_name) const {
+            return row(get_row_idx(row_name));
         }
 
         RowGroupView<row_type> rows() {
@@ -355,41 +707,365 @@ namespace df {
         }
 
         column_iterator iter_cols() {
-            return column_iterator(begin(), m_col_size, m_row_size);
+            return column_iterator(this);
         }
 
         const_column_iterator iter_cols() const {
-            return const_column_iterator(begin(), m_col_size, m_row_size);
+            return const_column_iterator(this);
         }
 
         const_column_iterator citer_cols() const {
-            return const_column_iterator(begin(), m_col_size, m_row_size);
+            return const_column_iterator(this);
         }
 
         row_iterator iter_rows() {
-            return row_iterator(begin(), m_row_size);
+            return row_iterator(this);
         }
 
         const_row_iterator iter_rows() const {
-            return const_row_iterator(begin(), m_row_size);
+            return const_row_iterator(this);
         }
 
         const_row_iterator citer_rows() {
-            return const_row_iterator(begin(), m_row_size);
+            return const_row_iterator(this);
         }
 
         bool is_null() const {
             return (m_d == nullptr) && (m_col_count == 0) && (m_col_size == 0) && (m_row_size == 0) && (m_row_count == 0) && (m_current_size == 0);
         }
 
-        template<std::enable_if_t<std::is_arithmetic_v<data_type>, bool> = true>
-        RowGroupView<row_type> sort(std::string column_name, bool ascending = false) {
-            return RowGroupView<row_type>(this).sort(column_name, ascending);
+        RowGroupView<row_type> sort(std::string_view column_name, bool ascending = false, NullOrder nulls = NullOrder::Last)
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<row_type>(this).sort(column_name, ascending, nulls);
+        }
+
+        RowGroupView<const_row_type> sort(std::string_view column_name, bool ascending = false, NullOrder nulls = NullOrder::Last) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<const_row_type>(this).sort(column_name, ascending, nulls);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<row_type> sort(Policy policy, std::string_view column_name, bool ascending = false, NullOrder nulls = NullOrder::Last)
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<row_type>(this).sort(policy, column_name, ascending, nulls);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<const_row_type> sort(Policy           policy,
+                                          std::string_view column_name,
+                                          bool             ascending = false,
+                                          NullOrder        nulls     = NullOrder::Last) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<const_row_type>(this).sort(policy, column_name, ascending, nulls);
         }
 
-        template<std::enable_if_t<std::is_arithmetic_v<data_type>, bool> = true>
-        RowGroupView<const_row_type> sort(std::string column_name, bool ascending = false) const {
-            return RowGroupView<const_row_type>(this).sort(column_name, ascending);
+        RowGroupView<row_type> sort(const std::vector<SortKey>& keys)
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<row_type>(this).sort(keys);
+        }
+
+        RowGroupView<const_row_type> sort(const std::vector<SortKey>& keys) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<const_row_type>(this).sort(keys);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<row_type> sort(Policy policy, const std::vector<SortKey>& keys)
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<row_type>(this).sort(policy, keys);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<const_row_type> sort(Policy policy, const std::vector<SortKey>& keys) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return RowGroupView<const_row_type>(this).sort(policy, keys);
+        }
+
+        // the k rows with the largest values in column_name, largest first, see select_top_k().
+        RowGroupView<row_type> nlargest(std::string_view column_name, std::size_t k)
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nlargest(k);
+        }
+
+        RowGroupView<const_row_type> nlargest(std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nlargest(k);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<row_type> nlargest(Policy policy, std::string_view column_name, std::size_t k)
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nlargest(policy, k);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<const_row_type> nlargest(Policy policy, std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nlargest(policy, k);
+        }
+
+        // the k rows with the smallest values in column_name, smallest first.
+        RowGroupView<row_type> nsmallest(std::string_view column_name, std::size_t k)
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nsmallest(k);
+        }
+
+        RowGroupView<const_row_type> nsmallest(std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nsmallest(k);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<row_type> nsmallest(Policy policy, std::string_view column_name, std::size_t k)
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nsmallest(policy, k);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView<const_row_type> nsmallest(Policy policy, std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return column(column_name).nsmallest(policy, k);
+        }
+
+        // row permutation that sorts the frame by column_name, without touching the frame. see sort_rows_by().
+        std::vector<std::size_t> argsort(std::string_view column_name, bool ascending = false, NullOrder nulls = NullOrder::Last) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return df::argsort(column(column_name), ascending, nulls);
+        }
+
+        template<execution_policy Policy>
+        std::vector<std::size_t> argsort(Policy policy, std::string_view column_name, bool ascending = false, NullOrder nulls = NullOrder::Last) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return df::argsort(policy, column(column_name), ascending, nulls);
+        }
+
+        // per column reductions, element i of the result belongs to column i. see df_reduce.hpp.
+        Series<sum_t<T>> sum(Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return reduce_columns<sum_t<T>>([mode](const const_column_type& col) { return col.sum(mode); });
+        }
+
+        Series<double> mean(Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return reduce_columns<double>([mode](const const_column_type& col) { return col.mean(mode); });
+        }
+
+        Series<double> var(std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return reduce_columns<double>([ddof, mode](const const_column_type& col) { return col.var(ddof, mode); });
+        }
+
+        Series<double> std(std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return reduce_columns<double>([ddof, mode](const const_column_type& col) { return col.std(ddof, mode); });
+        }
+
+        Series<sum_t<T>> prod() const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return reduce_columns<sum_t<T>>([](const const_column_type& col) { return col.prod(); });
+        }
+
+        // row index of the smallest/largest value of each column.
+        Series<std::size_t> argmin() const
+            requires(std::totally_ordered<T>)
+        {
+            return reduce_columns<std::size_t>([](const const_column_type& col) { return col.argmin(); });
+        }
+
+        Series<std::size_t> argmax() const
+            requires(std::totally_ordered<T>)
+        {
+            return reduce_columns<std::size_t>([](const const_column_type& col) { return col.argmax(); });
+        }
+
+        Series<std::size_t> count() const {
+            return reduce_columns<std::size_t>([](const const_column_type& col) { return col.count(); });
+        }
+
+        // per column reductions split into blocks of rows and across the columns, reproducible for any thread count.
+        // see column_block_partials() and reduction_block. a frame with validity bitmaps reduces column by column instead.
+        template<execution_policy Policy>
+        Series<sum_t<T>> sum(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            if (!m_validity.empty()) { return reduce_columns<sum_t<T>>([&](const const_column_type& col) { return col.sum(policy, mode); }); }
+            return combine_column_blocks<sum_t<T>>(policy, mode, [mode](std::size_t, const value_type* values, std::size_t count) {
+                return detail::sum<simd::Fold::Sum>(values, count, 1, sum_t<T>{}, mode);
+            });
+        }
+
+        template<execution_policy Policy>
+        Series<double> mean(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            if (!m_validity.empty()) { return reduce_columns<double>([&](const const_column_type& col) { return col.mean(policy, mode); }); }
+            Series<sum_t<T>> sums = sum(policy, mode);
+            Series<double>   means(m_col_count);
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                means[col_idx] = static_cast<double>(sums[col_idx]) / static_cast<double>(m_row_count);
+            }
+            return means;
+        }
+
+        template<execution_policy Policy>
+        Series<double> var(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            if (!m_validity.empty()) { return reduce_columns<double>([&](const const_column_type& col) { return col.var(policy, ddof, mode); }); }
+            using acc_type           = detail::variance_acc_t<T>;
+            Series<double> means     = mean(policy, mode);
+            auto           deviation = [&means, mode](std::size_t col_idx, const value_type* values, std::size_t count) {
+                return detail::sum<simd::Fold::SquaredDeviation>(values, count, 1, static_cast<acc_type>(means[col_idx]), mode);
+            };
+
+            Series<acc_type> deviations = combine_column_blocks<acc_type>(policy, mode, deviation);
+            Series<double>   result(m_col_count);
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                result[col_idx] = m_row_count <= ddof ? std::numeric_limits<double>::quiet_NaN()
+                                                      : static_cast<double>(deviations[col_idx]) / static_cast<double>(m_row_count - ddof);
+            }
+            return result;
+        }
+
+        template<execution_policy Policy>
+        Series<double> std(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            Series<double> result = var(policy, ddof, mode);
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                result[col_idx] = std::sqrt(result[col_idx]);
+            }
+            return result;
+        }
+
+        template<execution_policy Policy>
+        Series<T> min(Policy policy) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return column_extremum<false>(policy);
+        }
+
+        template<execution_policy Policy>
+        Series<T> max(Policy policy) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return column_extremum<true>(policy);
+        }
+
+        // count, mean, std, min, 25%, 50%, 75% and max of every column, a row per statistic and a column per column of the frame.
+        // a single sweep over the buffer in memory order accumulates the ColumnStats and fills a column major copy of the values,
+        // the std (from the mean) and the quantiles are then computed column by column on the copy. NaN values are not counted.
+        DataFrame<double> describe() const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return describe(execution::seq);
+        }
+
+        template<execution_policy Policy>
+        DataFrame<double> describe(Policy policy) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            std::size_t thread_count = 1;
+            if constexpr (is_parallel_policy_v<Policy>) { thread_count = resolve_thread_count(policy.thread_count); }
+            std::size_t blocks = std::max<std::size_t>(std::min(thread_count, m_row_count), 1);
+
+            std::vector<double>      values(m_current_size);
+            std::vector<ColumnStats> partials(blocks, ColumnStats(m_col_count));
+            parallel_for(
+            0,
+            blocks,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t block = first; block < last; block++) {
+                    describe_rows((m_row_count * block) / blocks, (m_row_count * (block + 1)) / blocks, partials[block], values);
+                }
+            },
+            blocks);
+            for (std::size_t block = 1; block < blocks; block++) {
+                partials[0].merge(partials[block]);
+            }
+
+            static constexpr std::array<double, 3> qs{0.25, 0.5, 0.75};
+            const ColumnStats&                     stats = partials[0];
+            DataFrame<double> result(m_col_labels.names(), {"count", "mean", "std", "min", "25%", "50%", "75%", "max"}, Layout::ColumnMajor);
+            parallel_for(
+            0,
+            m_col_count,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t col_idx = first; col_idx < last; col_idx++) {
+                    std::size_t count  = stats.counts[col_idx];
+                    double*     column = values.data() + (col_idx * m_row_count);
+                    // moves the numbers in front, in order, the statistics below only read the first count values.
+                    if (count < m_row_count) {
+                        double* numbers_end = std::remove_if(column, column + m_row_count, [](double value) { return std::isnan(value); });
+                        FORCED_ASSERT(numbers_end == column + count, "describe counted a different number of values than it kept");
+                    }
+
+                    double nan  = std::numeric_limits<double>::quiet_NaN();
+                    double mean = count == 0 ? nan : stats.sums[col_idx] / static_cast<double>(count);
+                    double var  = count < 2 ? nan
+                                            : detail::sum<simd::Fold::SquaredDeviation>(column, count, 1, mean, Summation::Pairwise)
+                                             / static_cast<double>(count - 1);
+
+                    std::array<double, 3> quartiles;
+                    quantiles(column, count, qs.data(), qs.size(), quartiles.data());
+
+                    result[col_idx, 0] = static_cast<double>(count);
+                    result[col_idx, 1] = mean;
+                    result[col_idx, 2] = std::sqrt(var);
+                    result[col_idx, 3] = count == 0 ? nan : stats.mins[col_idx];
+                    result[col_idx, 4] = quartiles[0];
+                    result[col_idx, 5] = quartiles[1];
+                    result[col_idx, 6] = quartiles[2];
+                    result[col_idx, 7] = count == 0 ? nan : stats.maxs[col_idx];
+                }
+            },
+            thread_count);
+            return result;
+        }
+
+        // lazy view of the given rows in the given order, e.g. a permutation from argsort().
+        // construct a DataFrame from the view to gather the rows into a new buffer.
+        RowGroupView<row_type> take(std::vector<std::size_t> rows) {
+            return RowGroupView<row_type>(this, std::move(rows));
+        }
+
+        RowGroupView<const_row_type> take(std::vector<std::size_t> rows) const {
+            return RowGroupView<const_row_type>(this, std::move(rows));
+        }
+
+        // lazy view of the rows whose bit is set, in frame order, e.g. filter(df["price"] > 100.0).
+        // no cell is copied, call to_dataframe() on the result to materialize a compact frame.
+        RowGroupView<row_type> filter(const Mask& mask) {
+            FORCED_ASSERT(mask.size() == m_row_count, "filter with a mask of nonmatching size");
+            return RowGroupView<row_type>(this, mask.indices());
+        }
+
+        RowGroupView<const_row_type> filter(const Mask& mask) const {
+            FORCED_ASSERT(mask.size() == m_row_count, "filter with a mask of nonmatching size");
+            return RowGroupView<const_row_type>(this, mask.indices());
         }
 
         template<std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
@@ -400,15 +1076,289 @@ namespace df {
         dataframe_logger logger;
 
       private:
-        std::map<std::string, std::size_t> m_col_idx_map;
-        std::map<std::string, std::size_t> m_row_idx_map;
-        // we call it current size because it can change, when we implement appending/removing cols and rows
+        template<typename R, typename Fn>
+        Series<R> reduce_columns(Fn fn) const {
+            Series<R> result(m_col_count);
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                result[col_idx] = fn(column(col_idx));
+            }
+            return result;
+        }
+
+        // fn(col_idx, values, count) on fixed blocks of rows of every column, the result for block b of column c at [(c * blocks) + b].
+        // a column major block is a run of the column. a row major block of rows is transposed into a per chunk scratch first, so the
+        // buffer is read in memory order and fn always gets contiguous values. the blocks only depend on the shape, not on the threads.
+        template<typename Acc, execution_policy Policy, typename Fn>
+        std::vector<Acc> column_block_partials(Policy policy, std::size_t& blocks, Fn fn) const {
+            bool        row_major  = m_layout == Layout::RowMajor;
+            std::size_t block_rows = row_major ? std::max<std::size_t>(reduction_block / std::max<std::size_t>(m_col_count, 1), 1) : reduction_block;
+            blocks                 = (m_row_count + block_rows - 1) / block_rows;
+
+            std::vector<Acc> partials(m_col_count * blocks);
+            if (row_major) {
+                parallel_for(
+                policy,
+                0,
+                blocks,
+                [&](std::size_t first, std::size_t last) {
+                    std::vector<value_type> scratch(block_rows * m_col_count);
+                    for (std::size_t block = first; block < last; block++) {
+                        std::size_t row_begin = block * block_rows;
+                        std::size_t rows      = std::min(block_rows, m_row_count - row_begin);
+                        for (std::size_t row_idx = 0; row_idx < rows; row_idx++) {
+                            const value_type* row = m_d + ((row_begin + row_idx) * m_row_size);
+                            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                                scratch[(col_idx * rows) + row_idx] = row[col_idx];
+                            }
+                        }
+                        for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                            partials[(col_idx * blocks) + block] = fn(col_idx, scratch.data() + (col_idx * rows), rows);
+                        }
+                    }
+                },
+                1);
+            } else {
+                parallel_for(
+                policy,
+                0,
+                m_col_count * blocks,
+                [&](std::size_t first, std::size_t last) {
+                    for (std::size_t task = first; task < last; task++) {
+                        std::size_t col_idx   = task / blocks;
+                        std::size_t row_begin = (task % blocks) * block_rows;
+                        partials[task]        = fn(col_idx, m_d + (col_idx * m_col_size) + row_begin, std::min(block_rows, m_row_count - row_begin));
+                    }
+                },
+                1);
+            }
+            return partials;
+        }
+
+        template<typename Acc, execution_policy Policy, typename Fn>
+        Series<Acc> combine_column_blocks(Policy policy, Summation mode, Fn fn) const {
+            std::size_t      blocks   = 0;
+            std::vector<Acc> partials = column_block_partials<Acc>(policy, blocks, fn);
+            Series<Acc>      result(m_col_count);
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                result[col_idx] = detail::combine_blocks(partials.data() + (col_idx * blocks), blocks, mode);
+            }
+            return result;
+        }
+
+        template<bool Max, execution_policy Policy>
+        Series<T> column_extremum(Policy policy) const {
+            FORCED_ASSERT(m_row_count > 0, "min/max of a frame without rows");
+            if (!m_validity.empty()) {
+                return reduce_columns<T>([&](const const_column_type& col) { return Max ? col.max(policy) : col.min(policy); });
+            }
+            std::size_t    blocks   = 0;
+            std::vector<T> partials = column_block_partials<T>(
+            policy, blocks, [](std::size_t, const value_type* values, std::size_t count) { return extremum<Max>(values, count); });
+            Series<T> result(m_col_count);
+            for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                result[col_idx] = extremum<Max>(partials.data() + (col_idx * blocks), blocks);
+            }
+            return result;
+        }
+
+        // rows [row_begin, row_end) into stats and the column major copy, walking the buffer in memory order.
+        // null cells are read as NaN so they are not counted.
+        void describe_rows(std::size_t row_begin, std::size_t row_end, ColumnStats& stats, std::vector<double>& values) const {
+            double nan = std::numeric_limits<double>::quiet_NaN();
+            if (m_layout == Layout::RowMajor) {
+                for (std::size_t row_idx = row_begin; row_idx < row_end; row_idx++) {
+                    const value_type* row = m_d + (row_idx * m_row_size);
+                    for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                        double value = m_validity.empty() || is_valid(col_idx, row_idx) ? static_cast<double>(row[col_idx]) : nan;
+                        stats.push(col_idx, value);
+                        values[(col_idx * m_row_count) + row_idx] = value;
+                    }
+                }
+            } else {
+                for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                    const value_type* col   = m_d + (col_idx * m_col_size);
+                    const Mask*       valid = validity(col_idx);
+                    for (std::size_t row_idx = row_begin; row_idx < row_end; row_idx++) {
+                        double value = valid == nullptr || (*valid)[row_idx] ? static_cast<double>(col[row_idx]) : nan;
+                        stats.push(col_idx, value);
+                        values[(col_idx * m_row_count) + row_idx] = value;
+                    }
+                }
+            }
+        }
+
+        template<typename Op>
+        DataFrame& apply_frame(const DataFrame& rhs) {
+            FORCED_ASSERT(m_col_count == rhs.m_col_count && m_row_count == rhs.m_row_count, "arithmetic operation on nonmatching shape frames");
+            if (m_layout == rhs.m_layout) {
+                apply_in_place<Op>(m_d, rhs.m_d, m_current_size);
+            } else {
+                for (std::size_t col_idx = 0; col_idx < m_col_count; col_idx++) {
+                    column_type col = column(col_idx);
+                    apply_in_place<Op>(col.data(), col.size(), col.stride(), rhs.column(col_idx));
+                }
+            }
+            return *this;
+        }
+
+        void set_layout(Layout layout) {
+            m_layout = layout;
+            if (m_layout == Layout::RowMajor) {
+                m_col_stride = m_row_size;
+                m_row_stride = 1;
+            } else {
+                m_col_stride = 1;
+                m_row_stride = m_col_size;
+            }
+        }
+
+        void reallocate(std::size_t capacity) {
+            value_type* buffer = new value_type[capacity];
+            std::move(m_d, m_d + m_current_size, buffer);
+            free_buffer();
+            m_d        = buffer;
+            m_capacity = capacity;
+        }
+
+        // room for size values, at least doubling the capacity when it has to grow.
+        void grow(std::size_t size) {
+            if (size > m_capacity) { reallocate(std::max(size, m_capacity * 2)); }
+        }
+
+        // sets the counts, sizes and strides after a shape change, the labels are already updated.
+        void reshape(std::size_t col_count, std::size_t row_count) {
+            m_col_count    = col_count;
+            m_row_count    = row_count;
+            m_col_size     = m_row_count;
+            m_row_size     = m_col_count;
+            m_current_size = m_col_count * m_row_count;
+            set_layout(m_layout);
+            logging_context.max_col_name_size = m_col_labels.max_name_size();
+            logging_context.max_row_name_size = m_row_labels.max_name_size();
+            logger.with_context(logging_context);
+        }
+
+        static std::vector<bool> keep_mask(const std::vector<std::size_t>& dropped, std::size_t count) {
+            std::vector<bool> keep(count, true);
+            for (std::size_t idx : dropped) {
+                if (idx >= count) { throw std::out_of_range("Drop index out of range: " + std::to_string(idx)); }
+                keep[idx] = false;
+            }
+            return keep;
+        }
+
+        static std::vector<std::size_t> positions_of(const LabelIndex& labels, const std::vector<std::string>& names) {
+            std::vector<std::size_t> positions;
+            positions.reserve(names.size());
+            for (const auto& name : names) {
+                positions.push_back(labels.at(name));
+            }
+            return positions;
+        }
+
+        // keeps the cells whose row and column are both kept, one pass in buffer order. every kept value moves to a position
+        // at or before its own, so nothing is overwritten before it is read. an external buffer, e.g. a mapped file, is left
+        // untouched and the kept values are copied into a buffer of our own, like reallocate().
+        void compact(const std::vector<bool>& keep_rows, const std::vector<bool>& keep_cols) {
+            bool                     row_major = m_layout == Layout::RowMajor;
+            const std::vector<bool>& keep_out  = row_major ? keep_rows : keep_cols;
+            const std::vector<bool>& keep_in   = row_major ? keep_cols : keep_rows;
+            std::size_t              inner     = keep_in.size();
+            std::size_t              write     = 0;
+            std::size_t              kept_rows = static_cast<std::size_t>(std::count(keep_rows.begin(), keep_rows.end(), true));
+            std::size_t              kept_cols = static_cast<std::size_t>(std::count(keep_cols.begin(), keep_cols.end(), true));
+            value_type*              dst       = m_buffer_owner ? new value_type[kept_rows * kept_cols] : m_d;
+            for (std::size_t out = 0; out < keep_out.size(); out++) {
+                if (!keep_out[out]) { continue; }
+                for (std::size_t in = 0; in < inner; in++) {
+                    if (keep_in[in]) { dst[write++] = std::move(m_d[(out * inner) + in]); }
+                }
+            }
+            if (dst != m_d) {
+                free_buffer();
+                m_d        = dst;
+                m_capacity = kept_rows * kept_cols;
+            }
+
+            if (!m_validity.empty()) {
+                std::vector<std::optional<Mask>> kept_validity;
+                for (std::size_t col_idx = 0; col_idx < keep_cols.size(); col_idx++) {
+                    if (!keep_cols[col_idx]) { continue; }
+                    std::optional<Mask>& kept = kept_validity.emplace_back();
+                    if (!m_validity[col_idx]) { continue; }
+                    kept.emplace(0);
+                    for (std::size_t row_idx = 0; row_idx < keep_rows.size(); row_idx++) {
+                        if (keep_rows[row_idx]) { kept->resize(kept->size() + 1, (*m_validity[col_idx])[row_idx]); }
+                    }
+                }
+                m_validity = std::move(kept_validity);
+            }
+
+            m_row_labels = kept_labels(m_row_labels, keep_rows);
+            m_col_labels = kept_labels(m_col_labels, keep_cols);
+            reshape(m_col_labels.size(), m_row_labels.size());
+        }
+
+        static LabelIndex kept_labels(const LabelIndex& labels, const std::vector<bool>& keep) {
+            LabelIndex kept;
+            kept.reserve(labels.size());
+            for (std::size_t pos = 0; pos < labels.size(); pos++) {
+                if (keep[pos]) { kept.push_back(labels.name(pos)); }
+            }
+            return kept;
+        }
+
+        void free_buffer() noexcept {
+            if (!m_buffer_owner) { delete[] m_d; }
+            m_buffer_owner.reset();
+        }
+
+        // leaves the frame empty without freeing the buffer, used after the buffer was moved out.
+        void release() noexcept {
+            m_col_labels.clear();
+            m_row_labels.clear();
+            m_current_size = 0;
+            m_capacity     = 0;
+            m_col_size     = 0;
+            m_col_count    = 0;
+            m_row_size     = 0;
+            m_row_count    = 0;
+            m_col_stride   = 0;
+            m_row_stride   = 0;
+            m_d            = nullptr;
+            m_validity.clear();
+        }
+
+        std::size_t offset_of(std::size_t col_idx, std::size_t row_idx) const {
+            return (col_idx * m_row_stride) + (row_idx * m_col_stride);
+        }
+
+        std::size_t offset_of(std::string_view col_name, std::string_view row_name) const {
+            std::size_t col_idx = m_col_labels.find(col_name);
+            std::size_t row_idx = m_row_labels.find(row_name);
+            if (col_idx == LabelIndex::npos || row_idx == LabelIndex::npos) {
+                throw std::out_of_range("Column/row name not found: " + std::string(col_name) + "/" + std::string(row_name));
+            }
+            return offset_of(col_idx, row_idx);
+        }
+
+        LabelIndex m_col_labels;
+        LabelIndex m_row_labels;
+        // values in use, the buffer holds m_capacity values, see reserve().
         std::size_t m_current_size;
+        std::size_t m_capacity;
         std::size_t m_col_size;
         std::size_t m_col_count;
         std::size_t m_row_size;
         std::size_t m_row_count;
+        Layout      m_layout;
+        std::size_t m_col_stride;
+        std::size_t m_row_stride;
         value_type* m_d;
+        // holds an external buffer alive, m_d is not ours to delete while it is set.
+        std::shared_ptr<void> m_buffer_owner;
+        // the validity bitmap of each column, empty until a first null is set and then one entry per column, see set_null().
+        std::vector<std::optional<Mask>> m_validity;
 
         LoggingContext<data_type> logging_context;
     };
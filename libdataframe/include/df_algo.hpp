@@ -2,6 +2,8 @@
 #define DATA_FRAME_UTILS_H
 
 #include "df_common.hpp"
+#include "df_parallel.hpp"
+#include "df_simd.hpp"
 
 namespace df {
     template<typename T>
@@ -10,22 +12,203 @@ namespace df {
     template<typename T>
     class DataFrame;
 
+    /*
+     algorithms over the value buffer of a DataFrame or a Series, no Cell or Index is built on the way.
+     each one takes an execution policy first, the overload without one is sequenced:
+        seq        one loop on the calling thread.
+        par        contiguous chunks of at least parallel_grain values on default_pool().
+        par_unseq  par with the chunk loops marked DF_IVDEP, element functions must not depend on each other.
+     frames are walked in buffer order, two frames in one algorithm must have the same shape and layout.
+    */
+
+    template<typename C>
+    concept value_buffer = requires(C& c) {
+        { c.data() } -> std::convertible_to<const typename C::value_type*>;
+        { c.size() } -> std::convertible_to<std::size_t>;
+    };
+
+    namespace detail {
+        template<execution_policy Policy, typename Body>
+        void index_loop(std::size_t first, std::size_t last, Body&& body) {
+            if constexpr (is_unsequenced_policy_v<Policy>) {
+                DF_IVDEP
+                for (std::size_t i = first; i < last; i++) {
+                    body(i);
+                }
+            } else {
+                for (std::size_t i = first; i < last; i++) {
+                    body(i);
+                }
+            }
+        }
+
+        template<typename A, typename B>
+        void assert_same_shape(const A& a, const B& b) {
+            FORCED_ASSERT(a.size() == b.size(), "algorithm on nonmatching size objects");
+            if constexpr (requires { a.layout() == b.layout(); }) {
+                FORCED_ASSERT(a.col_count() == b.col_count() && a.layout() == b.layout(), "algorithm on nonmatching shape or layout frames");
+            }
+        }
+    } // namespace detail
+
+    template<execution_policy Policy, value_buffer C>
+    void fill(Policy policy, C& c, const typename C::value_type& value) {
+        using value_type = typename C::value_type;
+        auto* data       = c.data();
+        parallel_for(policy, 0, c.size(), [data, &value](std::size_t first, std::size_t last) {
+            if constexpr (simd::vectorizable<value_type>) {
+                simd::fill(data + first, value, last - first);
+            } else {
+                detail::index_loop<Policy>(first, last, [data, &value](std::size_t i) { data[i] = value; });
+            }
+        });
+    }
+
+    template<value_buffer C>
+    void fill(C& c, const typename C::value_type& value) {
+        fill(execution::seq, c, value);
+    }
+
+    // c[i] = fn(c[i]).
+    template<execution_policy Policy, value_buffer C, typename Fn>
+    void transform(Policy policy, C& c, Fn fn) {
+        auto* data = c.data();
+        parallel_for(policy, 0, c.size(), [data, &fn](std::size_t first, std::size_t last) {
+            detail::index_loop<Policy>(first, last, [data, &fn](std::size_t i) { data[i] = fn(data[i]); });
+        });
+    }
+
+    template<value_buffer C, typename Fn>
+    void transform(C& c, Fn fn) {
+        transform(execution::seq, c, std::move(fn));
+    }
+
+    // out[i] = fn(in[i]), out may be in.
+    template<execution_policy Policy, value_buffer In, value_buffer Out, typename Fn>
+    void transform(Policy policy, const In& in, Out& out, Fn fn) {
+        detail::assert_same_shape(in, out);
+        const auto* src = in.data();
+        auto*       dst = out.data();
+        parallel_for(policy, 0, in.size(), [src, dst, &fn](std::size_t first, std::size_t last) {
+            detail::index_loop<Policy>(first, last, [src, dst, &fn](std::size_t i) { dst[i] = fn(src[i]); });
+        });
+    }
+
+    template<value_buffer In, value_buffer Out, typename Fn>
+    void transform(const In& in, Out& out, Fn fn) {
+        transform(execution::seq, in, out, std::move(fn));
+    }
+
+    // out[i] = fn(lhs[i], rhs[i]), out may be lhs or rhs.
+    template<execution_policy Policy, value_buffer L, value_buffer R, value_buffer Out, typename Fn>
+    void zip_transform(Policy policy, const L& lhs, const R& rhs, Out& out, Fn fn) {
+        detail::assert_same_shape(lhs, rhs);
+        detail::assert_same_shape(lhs, out);
+        const auto* l   = lhs.data();
+        const auto* r   = rhs.data();
+        auto*       dst = out.data();
+        parallel_for(policy, 0, lhs.size(), [l, r, dst, &fn](std::size_t first, std::size_t last) {
+            detail::index_loop<Policy>(first, last, [l, r, dst, &fn](std::size_t i) { dst[i] = fn(l[i], r[i]); });
+        });
+    }
+
+    template<value_buffer L, value_buffer R, value_buffer Out, typename Fn>
+    void zip_transform(const L& lhs, const R& rhs, Out& out, Fn fn) {
+        zip_transform(execution::seq, lhs, rhs, out, std::move(fn));
+    }
+
+    template<execution_policy Policy, value_buffer C, typename Pred>
+    std::size_t count_if(Policy policy, const C& c, Pred pred) {
+        const auto*              data = c.data();
+        std::atomic<std::size_t> total{0};
+        parallel_for(policy, 0, c.size(), [data, &pred, &total](std::size_t first, std::size_t last) {
+            std::size_t count = 0;
+            detail::index_loop<Policy>(first, last, [data, &pred, &count](std::size_t i) {
+                count += static_cast<std::size_t>(static_cast<bool>(pred(data[i])));
+            });
+            total.fetch_add(count, std::memory_order_relaxed);
+        });
+        return total.load();
+    }
+
+    template<value_buffer C, typename Pred>
+    std::size_t count_if(const C& c, Pred pred) {
+        return count_if(execution::seq, c, std::move(pred));
+    }
+
+    template<execution_policy Policy, value_buffer C, typename Pred>
+    void replace_if(Policy policy, C& c, Pred pred, const typename C::value_type& new_value) {
+        auto* data = c.data();
+        parallel_for(policy, 0, c.size(), [data, &pred, &new_value](std::size_t first, std::size_t last) {
+            detail::index_loop<Policy>(first, last, [data, &pred, &new_value](std::size_t i) {
+                if (pred(data[i])) { data[i] = new_value; }
+            });
+        });
+    }
+
+    template<value_buffer C, typename Pred>
+    void replace_if(C& c, Pred pred, const typename C::value_type& new_value) {
+        replace_if(execution::seq, c, std::move(pred), new_value);
+    }
+
+    // fn(df.column(i)) for every column, the parallel policies split the columns, not the values of a column.
+    template<execution_policy Policy, typename Frame, typename Fn>
+        requires(requires(Frame& df) { df.column(std::size_t{0}); })
+    void for_each_column(Policy policy, Frame& df, Fn fn) {
+        std::size_t grain = parallel_grain / std::max<std::size_t>(df.col_size(), 1);
+        parallel_for(
+        policy,
+        0,
+        df.col_count(),
+        [&df, &fn](std::size_t first, std::size_t last) {
+            for (std::size_t col_idx = first; col_idx < last; col_idx++) {
+                fn(df.column(col_idx));
+            }
+        },
+        grain);
+    }
+
+    template<typename Frame, typename Fn>
+        requires(requires(Frame& df) { df.column(std::size_t{0}); })
+    void for_each_column(Frame& df, Fn fn) {
+        for_each_column(execution::seq, df, std::move(fn));
+    }
+
+    // fn(df.row(i)) for every row, the parallel policies split the rows.
+    template<execution_policy Policy, typename Frame, typename Fn>
+        requires(requires(Frame& df) { df.row(std::size_t{0}); })
+    void for_each_row(Policy policy, Frame& df, Fn fn) {
+        std::size_t grain = parallel_grain / std::max<std::size_t>(df.row_size(), 1);
+        parallel_for(
+        policy,
+        0,
+        df.row_count(),
+        [&df, &fn](std::size_t first, std::size_t last) {
+            for (std::size_t row_idx = first; row_idx < last; row_idx++) {
+                fn(df.row(row_idx));
+            }
+        },
+        grain);
+    }
+
+    template<typename Frame, typename Fn>
+        requires(requires(Frame& df) { df.row(std::size_t{0}); })
+    void for_each_row(Frame& df, Fn fn) {
+        for_each_row(execution::seq, df, std::move(fn));
+    }
+
     template<typename T>
     void fill_df(DataFrame<T>& df, T fill_value)
         requires(std::assignable_from<T&, T>)
     {
-        for (auto& c : df) {
-            c.value = fill_value;
-        }
+        fill(execution::seq, df, fill_value);
     }
 
     template<typename T>
     void fill_series(Series<T>& series, const T& value)
         requires(std::assignable_from<T&, T>)
     {
-        for (std::size_t i = 0; i < series.size(); i++) {
-            series[i] = value;
-        }
+        fill(execution::seq, series, value);
     }
 
 } // namespace df
@@ -60,6 +60,7 @@ namespace df {
 
         BaseIterator operator+(difference_type n) const { return BaseIterator(m_ptr + n); }
         BaseIterator operator-(difference_type n) const { return BaseIterator(m_ptr - n); }
+        difference_type operator-(const BaseIterator& other) const { return m_ptr - other.m_ptr; }
 
         BaseIterator& operator+=(difference_type n) { m_ptr += n; return *this; }
         BaseIterator& operator-=(difference_type n) { m_ptr -= n; return *this; }
@@ -77,6 +78,78 @@ namespace df {
         pointer m_ptr = nullptr;
     };
 
+    // random access iterator over every n-th element of a buffer, used by the views that walk the frame
+    // buffer with a stride (a column of a row major frame, a row of a column major frame).
+    template<typename Iterable, bool IsConst>
+    class StridedIterator {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = typename Iterable::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference         = std::iter_reference_t<pointer>;
+
+      private:
+        template<typename>
+        friend class ColumnView;
+
+        template<typename>
+        friend class RowView;
+
+        template<typename, bool>
+        friend class StridedIterator;
+
+        StridedIterator(pointer ptr, difference_type stride) : m_ptr(ptr), m_stride(stride) {
+        }
+
+      public:
+        StridedIterator() = default;
+
+        // allow conversion from non-const to const iterator
+        StridedIterator(const StridedIterator<Iterable, false>& other)
+            requires(IsConst)
+            : m_ptr(other.m_ptr),
+              m_stride(other.m_stride) {
+        }
+
+        StridedIterator(const StridedIterator& other) = default;
+
+        StridedIterator& operator=(const StridedIterator& other) = default;
+
+        // clang-format off
+        reference operator*() const { return *m_ptr; }
+        pointer operator->() const { return m_ptr; }
+
+        reference operator[](difference_type n) const { return m_ptr[n * m_stride]; }
+
+        StridedIterator& operator++() { m_ptr += m_stride; return *this; }
+        StridedIterator operator++(int) { StridedIterator tmp = *this; m_ptr += m_stride; return tmp; }
+        StridedIterator& operator--() { m_ptr -= m_stride; return *this; }
+        StridedIterator operator--(int) { StridedIterator tmp = *this; m_ptr -= m_stride; return tmp; }
+
+        StridedIterator operator+(difference_type n) const { return StridedIterator(m_ptr + (n * m_stride), m_stride); }
+        StridedIterator operator-(difference_type n) const { return StridedIterator(m_ptr - (n * m_stride), m_stride); }
+        friend StridedIterator operator+(difference_type n, const StridedIterator& itr) { return itr + n; }
+        difference_type operator-(const StridedIterator& other) const { return m_stride == 0 ? 0 : (m_ptr - other.m_ptr) / m_stride; }
+
+        StridedIterator& operator+=(difference_type n) { m_ptr += n * m_stride; return *this; }
+        StridedIterator& operator-=(difference_type n) { m_ptr -= n * m_stride; return *this; }
+
+        bool operator==(const StridedIterator& other) const { return m_ptr == other.m_ptr; }
+        std::strong_ordering operator<=>(const StridedIterator& other) const { return m_ptr <=> other.m_ptr; }
+        // clang-format on
+
+        friend std::ostream& operator<<(std::ostream& os, const StridedIterator& itr) {
+            os << "StridedIterator(current addr: 0x" << std::hex << reinterpret_cast<const void*>(itr.m_ptr) << std::dec
+               << ", stride: " << itr.m_stride << ")";
+            return os;
+        }
+
+      private:
+        pointer         m_ptr    = nullptr;
+        difference_type m_stride = 0;
+    };
+
 }; // namespace df
 
 #endif // DATA_FRAME_BASE_ITERATOR_H
@@ -5,36 +5,19 @@
 
 namespace df {
     /*
-     TODO: is copying the index correct or even required? we should not touch the index of the cell,
-     once set shout not be tampered with, otherwise
-     copying cells will mix the indexing, therefore we should copy values only!
+     the frame buffer stores values only, an Index is derived on demand from the position of a value
+     and the frame labels (see DataFrame::index_of()), it is a snapshot and is not kept in sync with the frame.
     */
 
     struct Index {
 
-        Index() {
-        }
+        Index() = default;
 
-        Index(const Index& other)
-            : row_idx(other.row_idx),
-              col_idx(other.col_idx),
-              global_idx(other.global_idx),
-              col_name(other.col_name),
-              row_name(other.row_name) {
-        }
+        Index(const Index& other)     = default;
+        Index(Index&& other) noexcept = default;
 
-        // Index(const Index&& other) = delete; // TODO: should we allow move semantics?
-
-        Index& operator=(const Index& rhs) {
-            if (this != &rhs) {
-                row_idx    = rhs.row_idx;
-                col_idx    = rhs.col_idx;
-                global_idx = rhs.global_idx;
-                col_name   = rhs.col_name;
-                row_name   = rhs.row_name;
-            }
-            return *this;
-        }
+        Index& operator=(const Index& rhs)     = default;
+        Index& operator=(Index&& rhs) noexcept = default;
 
         std::size_t row_idx;
         std::size_t col_idx;
@@ -50,26 +33,19 @@ namespace df {
         }
     };
 
+    // a value together with its derived Index, see DataFrame::cell().
     template<typename T>
     class Cell {
       public:
         using data_type = T;
 
-        Cell() {
-        }
+        Cell() = default;
 
-        Cell(const Cell& other) : value(other.value), idx(other.idx) {
-        }
-
-        // Cell(const Cell&& other) = delete; //TODO: should we allow move semantics?
+        Cell(const Cell& other)     = default;
+        Cell(Cell&& other) noexcept = default;
 
-        Cell& operator=(const Cell& other) {
-            if (this != &other) {
-                value = other.value;
-                idx   = other.idx; // TODO: should we copy the index?
-            }
-            return *this;
-        }
+        Cell& operator=(const Cell& other)     = default;
+        Cell& operator=(Cell&& other) noexcept = default;
 
         void operator=(const data_type val) {
             value = val;
@@ -0,0 +1,488 @@
+#ifndef DATA_FRAME_CHUNKED_H
+#define DATA_FRAME_CHUNKED_H
+
+#include "df.hpp"
+#include "df_reduce.hpp"
+
+#include <memory>
+
+namespace df {
+
+    // rows per chunk of a ChunkedDataFrame when none is given, 512 KiB of doubles per column.
+    inline constexpr std::size_t default_chunk_rows = 1 << 16;
+
+    // one chunk of a ChunkedDataFrame, rows [row_begin, row_begin + row_count) of the frame.
+    // a column major chunk keeps each column in a run of chunk_rows values, a row major chunk keeps each row in a run of
+    // col_count values, so the last chunk fills up without moving its values.
+    template<typename V>
+    struct ChunkView {
+        using value_type = V;
+
+        V*          d;
+        std::size_t row_begin;
+        std::size_t row_count;
+        std::size_t col_count;
+        std::size_t col_stride; // distance between two values of a column.
+        std::size_t row_stride; // distance between two values of a row.
+
+        V& operator[](std::size_t col_idx, std::size_t row_idx) const {
+            return d[(col_idx * row_stride) + (row_idx * col_stride)];
+        }
+
+        // first value of a column, the next ones follow col_stride apart.
+        V* column(std::size_t col_idx) const {
+            return d + (col_idx * row_stride);
+        }
+
+        V* row(std::size_t row_idx) const {
+            return d + (row_idx * col_stride);
+        }
+    };
+
+    /*
+     a frame stored as a list of fixed size row chunks instead of one buffer. appending rows fills the last chunk and adds a new
+     one when it is full, no value is ever moved, and no allocation is larger than chunk_rows rows. per chunk work runs through
+     for_each_chunk(), and the policy reductions reduce every chunk on its own and combine the chunk results in chunk order,
+     so they give the same bits for any thread count, see reduction_block for the same rule on DataFrame.
+    */
+    template<typename T>
+    class ChunkedDataFrame {
+      public:
+        using value_type = T;
+
+        class ColumnIterator;
+
+        // a column as a forward range over the chunks.
+        class ColumnRange {
+          public:
+            ColumnRange(const ChunkedDataFrame* df, std::size_t col_idx) : m_df(df), m_col_idx(col_idx) {
+            }
+
+            ColumnIterator begin() const {
+                return ColumnIterator(m_df, m_col_idx, 0);
+            }
+
+            ColumnIterator end() const {
+                return ColumnIterator(m_df, m_col_idx, m_df->chunk_count());
+            }
+
+            std::size_t size() const {
+                return m_df->row_count();
+            }
+
+          private:
+            const ChunkedDataFrame* m_df;
+            std::size_t             m_col_idx;
+        };
+
+        // walks the values of a column with a pointer and only looks up the frame when it crosses into the next chunk.
+        class ColumnIterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+            ColumnIterator() = default;
+
+            ColumnIterator(const ChunkedDataFrame* df, std::size_t col_idx, std::size_t chunk_idx)
+                : m_df(df),
+                  m_col_idx(col_idx),
+                  m_chunk_idx(chunk_idx) {
+                enter_chunk();
+            }
+
+            const T& operator*() const {
+                return *m_current;
+            }
+
+            const T* operator->() const {
+                return m_current;
+            }
+
+            ColumnIterator& operator++() {
+                m_current += m_stride;
+                if (m_current == m_chunk_end) {
+                    m_chunk_idx++;
+                    enter_chunk();
+                }
+                return *this;
+            }
+
+            ColumnIterator operator++(int) {
+                ColumnIterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            bool operator==(const ColumnIterator& other) const {
+                return m_chunk_idx == other.m_chunk_idx && m_current == other.m_current;
+            }
+
+          private:
+            void enter_chunk() {
+                if (m_chunk_idx >= m_df->chunk_count()) {
+                    m_current   = nullptr;
+                    m_chunk_end = nullptr;
+                    return;
+                }
+                ChunkView<const T> chunk = m_df->chunk(m_chunk_idx);
+                m_stride                 = chunk.col_stride;
+                m_current                = chunk.column(m_col_idx);
+                m_chunk_end              = m_current + (chunk.row_count * m_stride);
+            }
+
+            const ChunkedDataFrame* m_df        = nullptr;
+            std::size_t             m_col_idx   = 0;
+            std::size_t             m_chunk_idx = 0;
+            std::size_t             m_stride    = 1;
+            const T*                m_current   = nullptr;
+            const T*                m_chunk_end = nullptr;
+        };
+
+        explicit ChunkedDataFrame(const std::vector<std::string>& col_names, std::size_t chunk_rows = default_chunk_rows, Layout layout = Layout::ColumnMajor)
+            : m_col_labels(col_names),
+              m_chunk_rows(chunk_rows),
+              m_row_count(0),
+              m_layout(layout) {
+            FORCED_ASSERT(m_chunk_rows > 0, "chunked frame with empty chunks");
+        }
+
+        // allocates every chunk up front and fills them with value initialized values, one chunk per task under a parallel
+        // policy, so the pages of a large frame are first touched by several threads instead of by the first writer.
+        template<execution_policy Policy>
+        ChunkedDataFrame(Policy                          policy,
+                         const std::vector<std::string>& col_names,
+                         const std::vector<std::string>& row_names,
+                         std::size_t                     chunk_rows = default_chunk_rows,
+                         Layout                          layout     = Layout::ColumnMajor)
+            : ChunkedDataFrame(col_names, chunk_rows, layout) {
+            m_row_labels = LabelIndex(row_names);
+            m_row_count  = row_names.size();
+            m_chunks.resize((m_row_count + m_chunk_rows - 1) / m_chunk_rows);
+            for_each_chunk_idx(policy, [this](std::size_t chunk_idx) { m_chunks[chunk_idx] = std::make_unique<T[]>(chunk_capacity()); });
+        }
+
+        ChunkedDataFrame(const ChunkedDataFrame& other)
+            : m_col_labels(other.m_col_labels),
+              m_row_labels(other.m_row_labels),
+              m_chunk_rows(other.m_chunk_rows),
+              m_row_count(other.m_row_count),
+              m_layout(other.m_layout),
+              m_chunks(other.m_chunks.size()) {
+            // only the filled rows are copied, the tail of the last chunk was never written.
+            for (std::size_t chunk_idx = 0; chunk_idx < m_chunks.size(); chunk_idx++) {
+                m_chunks[chunk_idx]    = std::make_unique_for_overwrite<T[]>(chunk_capacity());
+                ChunkView<const T> src = other.chunk(chunk_idx);
+                ChunkView<T>       dst = chunk(chunk_idx);
+                if (m_layout == Layout::RowMajor) {
+                    std::copy(src.d, src.d + (src.row_count * src.col_stride), dst.d);
+                } else {
+                    for (std::size_t col_idx = 0; col_idx < src.col_count; col_idx++) {
+                        std::copy(src.column(col_idx), src.column(col_idx) + src.row_count, dst.column(col_idx));
+                    }
+                }
+            }
+        }
+
+        ChunkedDataFrame(ChunkedDataFrame&& other) noexcept            = default;
+        ChunkedDataFrame& operator=(ChunkedDataFrame&& other) noexcept = default;
+
+        ChunkedDataFrame& operator=(const ChunkedDataFrame& other) {
+            if (this != &other) { *this = ChunkedDataFrame(other); }
+            return *this;
+        }
+
+        std::size_t col_count() const {
+            return m_col_labels.size();
+        }
+
+        std::size_t row_count() const {
+            return m_row_count;
+        }
+
+        std::size_t size() const {
+            return col_count() * m_row_count;
+        }
+
+        Shape shape() const {
+            return Shape{col_count(), m_row_count};
+        }
+
+        Layout layout() const {
+            return m_layout;
+        }
+
+        std::size_t chunk_rows() const {
+            return m_chunk_rows;
+        }
+
+        std::size_t chunk_count() const {
+            return m_chunks.size();
+        }
+
+        const LabelIndex& col_labels() const {
+            return m_col_labels;
+        }
+
+        const LabelIndex& row_labels() const {
+            return m_row_labels;
+        }
+
+        std::size_t get_col_idx(std::string_view col_name) const {
+            return m_col_labels.at(col_name);
+        }
+
+        std::size_t get_row_idx(std::string_view row_name) const {
+            return m_row_labels.at(row_name);
+        }
+
+        ChunkView<T> chunk(std::size_t chunk_idx) {
+            return make_chunk_view<T>(m_chunks[chunk_idx].get(), chunk_idx);
+        }
+
+        ChunkView<const T> chunk(std::size_t chunk_idx) const {
+            return make_chunk_view<const T>(m_chunks[chunk_idx].get(), chunk_idx);
+        }
+
+        T& operator[](std::size_t col_idx, std::size_t row_idx) {
+            return chunk(row_idx / m_chunk_rows)[col_idx, row_idx % m_chunk_rows];
+        }
+
+        const T& operator[](std::size_t col_idx, std::size_t row_idx) const {
+            return chunk(row_idx / m_chunk_rows)[col_idx, row_idx % m_chunk_rows];
+        }
+
+        T& operator[](std::string_view col_name, std::string_view row_name) {
+            return (*this)[get_col_idx(col_name), get_row_idx(row_name)];
+        }
+
+        const T& operator[](std::string_view col_name, std::string_view row_name) const {
+            return (*this)[get_col_idx(col_name), get_row_idx(row_name)];
+        }
+
+        ColumnRange column(std::size_t col_idx) const {
+            return ColumnRange(this, col_idx);
+        }
+
+        ColumnRange column(std::string_view col_name) const {
+            return ColumnRange(this, get_col_idx(col_name));
+        }
+
+        void append_row(std::string row_name, std::span<const value_type> values) {
+            std::vector<std::string> row_names;
+            row_names.push_back(std::move(row_name));
+            append_rows(row_names, values);
+        }
+
+        void append_row(std::string row_name, std::initializer_list<value_type> values) {
+            append_row(std::move(row_name), std::span<const value_type>(values.begin(), values.size()));
+        }
+
+        // values holds the new rows one after the other, col_count() values per row.
+        void append_rows(const std::vector<std::string>& row_names, std::span<const value_type> values) {
+            FORCED_ASSERT(values.size() == row_names.size() * col_count(), "appended rows with a nonmatching value count");
+            for (std::size_t row = 0; row < row_names.size(); row++) {
+                if (m_row_count == m_chunks.size() * m_chunk_rows) { m_chunks.push_back(std::make_unique_for_overwrite<T[]>(chunk_capacity())); }
+                ChunkView<T> last = chunk(m_chunks.size() - 1);
+                std::size_t  slot = m_row_count % m_chunk_rows;
+                for (std::size_t col_idx = 0; col_idx < col_count(); col_idx++) {
+                    last.d[(col_idx * last.row_stride) + (slot * last.col_stride)] = values[(row * col_count()) + col_idx];
+                }
+                m_row_labels.push_back(row_names[row]);
+                m_row_count++;
+            }
+        }
+
+        // fn(chunk) for every chunk, one chunk per task under a parallel policy.
+        template<execution_policy Policy, typename Fn>
+        void for_each_chunk(Policy policy, Fn fn) {
+            for_each_chunk_idx(policy, [this, &fn](std::size_t chunk_idx) { fn(chunk(chunk_idx)); });
+        }
+
+        template<execution_policy Policy, typename Fn>
+        void for_each_chunk(Policy policy, Fn fn) const {
+            for_each_chunk_idx(policy, [this, &fn](std::size_t chunk_idx) { fn(chunk(chunk_idx)); });
+        }
+
+        template<typename Fn>
+        void for_each_chunk(Fn fn) const {
+            for_each_chunk(execution::seq, std::move(fn));
+        }
+
+        // per column reductions, element i of the result belongs to column i.
+        template<execution_policy Policy>
+        Series<sum_t<T>> sum(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return combine_chunks<sum_t<T>>(policy, mode, [mode](std::size_t, const T* values, std::size_t count, std::size_t stride) {
+                return detail::sum<simd::Fold::Sum>(values, count, stride, sum_t<T>{}, mode);
+            });
+        }
+
+        template<execution_policy Policy>
+        Series<double> mean(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            Series<sum_t<T>> sums = sum(policy, mode);
+            Series<double>   means(col_count());
+            for (std::size_t col_idx = 0; col_idx < col_count(); col_idx++) {
+                means[col_idx] = static_cast<double>(sums[col_idx]) / static_cast<double>(m_row_count);
+            }
+            return means;
+        }
+
+        template<execution_policy Policy>
+        Series<double> var(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            using acc_type           = detail::variance_acc_t<T>;
+            Series<double> means     = mean(policy, mode);
+            auto           deviation = [&means, mode](std::size_t col_idx, const T* values, std::size_t count, std::size_t stride) {
+                return detail::sum<simd::Fold::SquaredDeviation>(values, count, stride, static_cast<acc_type>(means[col_idx]), mode);
+            };
+
+            Series<acc_type> deviations = combine_chunks<acc_type>(policy, mode, deviation);
+            Series<double>   result(col_count());
+            for (std::size_t col_idx = 0; col_idx < col_count(); col_idx++) {
+                result[col_idx] = m_row_count <= ddof ? std::numeric_limits<double>::quiet_NaN()
+                                                      : static_cast<double>(deviations[col_idx]) / static_cast<double>(m_row_count - ddof);
+            }
+            return result;
+        }
+
+        template<execution_policy Policy>
+        Series<double> std(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            Series<double> result = var(policy, ddof, mode);
+            for (auto& value : result) {
+                value = std::sqrt(value);
+            }
+            return result;
+        }
+
+        template<execution_policy Policy>
+        Series<T> min(Policy policy) const
+            requires(std::totally_ordered<T>)
+        {
+            return chunk_extremum<false>(policy);
+        }
+
+        template<execution_policy Policy>
+        Series<T> max(Policy policy) const
+            requires(std::totally_ordered<T>)
+        {
+            return chunk_extremum<true>(policy);
+        }
+
+        // copies the chunks into one DataFrame, one chunk per task under a parallel policy.
+        template<execution_policy Policy>
+        DataFrame<T> to_dataframe(Policy policy, Layout layout = Layout::ColumnMajor) const {
+            std::vector<std::string> col_names;
+            std::vector<std::string> row_names;
+            col_names.reserve(col_count());
+            row_names.reserve(m_row_count);
+            for (std::size_t col_idx = 0; col_idx < col_count(); col_idx++) {
+                col_names.push_back(m_col_labels.name(col_idx));
+            }
+            for (std::size_t row_idx = 0; row_idx < m_row_count; row_idx++) {
+                row_names.push_back(m_row_labels.name(row_idx));
+            }
+
+            DataFrame<T> df(col_names, row_names, layout);
+            T*           dst        = df.data();
+            std::size_t  col_stride = layout == Layout::RowMajor ? col_count() : 1;
+            std::size_t  row_stride = layout == Layout::RowMajor ? 1 : m_row_count;
+            for_each_chunk(policy, [&](const ChunkView<const T>& src) {
+                for (std::size_t col_idx = 0; col_idx < src.col_count; col_idx++) {
+                    for (std::size_t row_idx = 0; row_idx < src.row_count; row_idx++) {
+                        dst[(col_idx * row_stride) + ((src.row_begin + row_idx) * col_stride)] = src[col_idx, row_idx];
+                    }
+                }
+            });
+            return df;
+        }
+
+        DataFrame<T> to_dataframe(Layout layout = Layout::ColumnMajor) const {
+            return to_dataframe(execution::seq, layout);
+        }
+
+      private:
+        std::size_t chunk_capacity() const {
+            return m_chunk_rows * std::max<std::size_t>(col_count(), 1);
+        }
+
+        template<typename V>
+        ChunkView<V> make_chunk_view(V* d, std::size_t chunk_idx) const {
+            std::size_t row_begin = chunk_idx * m_chunk_rows;
+            std::size_t rows      = std::min(m_chunk_rows, m_row_count - row_begin);
+            if (m_layout == Layout::RowMajor) { return ChunkView<V>{d, row_begin, rows, col_count(), col_count(), 1}; }
+            return ChunkView<V>{d, row_begin, rows, col_count(), 1, m_chunk_rows};
+        }
+
+        template<execution_policy Policy, typename Fn>
+        void for_each_chunk_idx(Policy policy, Fn&& fn) const {
+            parallel_for(
+            policy,
+            0,
+            m_chunks.size(),
+            [&fn](std::size_t first, std::size_t last) {
+                for (std::size_t chunk_idx = first; chunk_idx < last; chunk_idx++) {
+                    fn(chunk_idx);
+                }
+            },
+            1);
+        }
+
+        // fn(col_idx, values, count, stride) for every column of every chunk, then the chunk results of each column combined
+        // in chunk order with mode.
+        template<typename Acc, execution_policy Policy, typename Fn>
+        Series<Acc> combine_chunks(Policy policy, Summation mode, Fn fn) const {
+            std::size_t      chunks = m_chunks.size();
+            std::vector<Acc> partials(col_count() * chunks);
+            for_each_chunk(policy, [&](const ChunkView<const T>& view) {
+                std::size_t chunk_idx = view.row_begin / m_chunk_rows;
+                for (std::size_t col_idx = 0; col_idx < view.col_count; col_idx++) {
+                    partials[(col_idx * chunks) + chunk_idx] = fn(col_idx, view.column(col_idx), view.row_count, view.col_stride);
+                }
+            });
+
+            Series<Acc> result(col_count());
+            for (std::size_t col_idx = 0; col_idx < col_count(); col_idx++) {
+                result[col_idx] = detail::combine_blocks(partials.data() + (col_idx * chunks), chunks, mode);
+            }
+            return result;
+        }
+
+        template<bool Max, execution_policy Policy>
+        Series<T> chunk_extremum(Policy policy) const {
+            FORCED_ASSERT(m_row_count > 0, "min/max of an empty frame");
+            std::size_t    chunks = m_chunks.size();
+            std::vector<T> partials(col_count() * chunks);
+            for_each_chunk(policy, [&](const ChunkView<const T>& view) {
+                std::size_t chunk_idx = view.row_begin / m_chunk_rows;
+                for (std::size_t col_idx = 0; col_idx < view.col_count; col_idx++) {
+                    partials[(col_idx * chunks) + chunk_idx] = extremum<Max>(view.column(col_idx), view.row_count, view.col_stride);
+                }
+            });
+
+            Series<T> result(col_count());
+            for (std::size_t col_idx = 0; col_idx < col_count(); col_idx++) {
+                result[col_idx] = extremum<Max>(partials.data() + (col_idx * chunks), chunks);
+            }
+            return result;
+        }
+
+        LabelIndex                        m_col_labels;
+        LabelIndex                        m_row_labels;
+        std::size_t                       m_chunk_rows;
+        std::size_t                       m_row_count;
+        Layout                            m_layout;
+        std::vector<std::unique_ptr<T[]>> m_chunks;
+    };
+
+} // namespace df
+
+#endif // DATA_FRAME_CHUNKED_H
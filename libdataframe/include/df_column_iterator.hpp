@@ -8,39 +8,32 @@ namespace df {
 
     template<typename dataframe, bool IsConst>
     class ColumnIterator {
-        using dataframe_iterator = std::conditional_t<IsConst, typename dataframe::const_iterator, typename dataframe::iterator>;
-        using column             = std::conditional_t<IsConst, typename dataframe::const_column_type, typename dataframe::column_type>;
+        using dataframe_pointer = std::conditional_t<IsConst, const dataframe*, dataframe*>;
+        using column            = std::conditional_t<IsConst, typename dataframe::const_column_type, typename dataframe::column_type>;
 
       public:
-        ColumnIterator(dataframe_iterator df_begin, std::size_t col_size, std::size_t row_size)
-            : m_ptr(df_begin),
-              m_col_size(col_size),
-              m_row_size(row_size),
-              m_current_col_idx(0) {
+        ColumnIterator(dataframe_pointer df) : m_df(df), m_current_col_idx(0) {
         }
 
         ~ColumnIterator() {
         }
 
-        ColumnIterator(const ColumnIterator<dataframe, true>& other)
+        ColumnIterator(const ColumnIterator<dataframe, false>& other)
             requires(IsConst)
-            : m_ptr(other.m_ptr) {
+            : m_df(other.m_df),
+              m_current_col_idx(other.m_current_col_idx) {
         }
 
-        ColumnIterator(const ColumnIterator& other)
-            : m_ptr(other.m_ptr),
-              m_col_size(other.m_col_size),
-              m_row_size(other.m_row_size),
-              m_current_col_idx(other.m_current_col_idx) {
+        ColumnIterator(const ColumnIterator& other) : m_df(other.m_df), m_current_col_idx(other.m_current_col_idx) {
         }
 
         // Implicit conversion to column; use for syntactic convenience (e.g., auto r = *it).
         operator column() {
-            return column(m_ptr + m_current_col_idx, m_col_size, m_row_size);
+            return current_col();
         }
 
         column current_col() {
-            return column(m_ptr + m_current_col_idx, m_col_size, m_row_size);
+            return m_df->column(m_current_col_idx);
         }
 
         std::size_t current_col_idx() const {
@@ -49,9 +42,7 @@ namespace df {
 
         ColumnIterator& operator=(const ColumnIterator& other) {
             if (this != &other) {
-                m_ptr             = other.m_ptr;
-                m_col_size        = other.m_col_size;
-                m_row_size        = other.m_row_size;
+                m_df              = other.m_df;
                 m_current_col_idx = other.m_current_col_idx;
             }
             return *this;
@@ -59,7 +50,7 @@ namespace df {
 
         ColumnIterator operator+(const std::size_t& off) const {
             ColumnIterator tmp{*this};
-            if (tmp += off; tmp.m_current_col_idx + off >= tmp.m_col_size) { throw std::out_of_range("ColumnIterator::operator+ out of range"); }
+            if (tmp += off; tmp.m_current_col_idx >= tmp.m_df->col_count()) { throw std::out_of_range("ColumnIterator::operator+ out of range"); }
             return tmp;
         }
 
@@ -95,31 +86,38 @@ namespace df {
             return *this;
         }
 
+        // every column holds col_size() cells whatever the layout is, so the n-th column is
+        // in range as long as n * col_size() is still inside the frame buffer.
         template<bool B>
         friend bool operator<(const ColumnIterator& lhs, const BaseIterator<dataframe, B>& rhs) {
-            return (lhs.m_ptr + (lhs.m_current_col_idx + (lhs.m_row_size * (lhs.m_col_size - 1)))) < rhs;
+            return lhs.position() < rhs;
         }
 
         template<bool B>
         friend bool operator<(const BaseIterator<dataframe, B>& lhs, const ColumnIterator& rhs) {
-            return lhs.m_ptr < (rhs.m_ptr + (rhs.m_current_col_idx + (rhs.m_row_size * rhs.m_col_size)));
+            return lhs < rhs.position();
         }
 
         template<bool B>
         friend bool operator>(const ColumnIterator& lhs, const BaseIterator<dataframe, B>& rhs) {
-            return (lhs.m_ptr + (lhs.m_current_col_idx + (lhs.m_row_size * lhs.m_col_size))) > rhs.m_ptr;
+            return lhs.position() > rhs;
         }
 
         template<bool B>
         friend bool operator>(const BaseIterator<dataframe, B>& lhs, const ColumnIterator& rhs) {
-            return lhs.m_ptr > (rhs.m_ptr + (rhs.m_current_col_idx + (rhs.m_row_size * rhs.m_col_size)));
+            return lhs > rhs.position();
         }
 
       private:
-        dataframe_iterator m_ptr;
-        std::size_t        m_col_size;
-        std::size_t        m_row_size;
-        std::size_t        m_current_col_idx;
+        template<typename, bool>
+        friend class ColumnIterator;
+
+        auto position() const {
+            return m_df->begin() + (m_current_col_idx * m_df->col_size());
+        }
+
+        dataframe_pointer m_df;
+        std::size_t       m_current_col_idx;
     };
 } // namespace df
 
@@ -4,13 +4,21 @@
 #include "df_base_iterator.hpp"
 #include "df_common.hpp"
 #include "df_series.hpp"
+#include "df_reduce.hpp"
+#include "df_sort.hpp"
 
 namespace df {
 
     template<typename T>
     class DataFrame;
 
-    template<typename CellType>
+    template<typename T>
+    class RowView;
+
+    template<typename T>
+    class RowGroupView;
+
+    template<typename ValueType>
     class ColumnView {
 
         template<typename>
@@ -20,501 +28,272 @@ namespace df {
         friend class ColumnIterator;
 
       public:
-        using data_type  = typename CellType::data_type;
-        using value_type = CellType*;
+        using data_type  = std::remove_const_t<ValueType>;
+        using value_type = data_type;
+        using reference  = ValueType&;
+        using pointer    = ValueType*;
         using dataframe_iterator
-        = std::conditional_t<std::is_const_v<CellType>, typename DataFrame<data_type>::const_iterator, typename DataFrame<data_type>::iterator>;
-        using iterator = BaseIterator<ColumnView<CellType>, std::is_const_v<CellType>>;
+        = std::conditional_t<std::is_const_v<ValueType>, typename DataFrame<data_type>::const_iterator, typename DataFrame<data_type>::iterator>;
+        using iterator   = StridedIterator<ColumnView<ValueType>, std::is_const_v<ValueType>>;
+        using group_type = RowGroupView<RowView<ValueType>>;
 
       private:
-        ColumnView(dataframe_iterator col_begin, std::size_t col_size, std::size_t stride) {
-            m_size   = col_size;
-            m_stride = stride;
-            m_d      = new value_type[col_size];
-
-            for (std::size_t idx = 0; idx < col_size; idx++) {
-                m_d[idx] = &(col_begin + (idx * stride));
-            }
+        // non-owning view: the first cell of the column, the number of cells and the distance between two of them.
+        ColumnView(dataframe_iterator col_begin, std::size_t col_size, std::size_t stride, std::size_t col_idx, const DataFrame<data_type>* df)
+            : m_df(df),
+              m_idx(col_idx),
+              m_size(col_size),
+              m_stride(stride),
+              m_d(&col_begin) {
         }
 
       public:
-        ColumnView() : m_size(0), m_stride(0), m_d(nullptr) {
+        ColumnView() : m_df(nullptr), m_idx(0), m_size(0), m_stride(0), m_d(nullptr) {
         }
 
-        ColumnView(const ColumnView& other) = delete;
-
-        ~ColumnView() {
-            delete[] m_d;
-        }
+        ColumnView(const ColumnView& other) = default;
 
-        value_type& operator[](const std::size_t idx) {
-            return m_d[idx];
-        }
+        // rebinds the view, assign a Series or an expression to copy values into the column.
+        ColumnView& operator=(const ColumnView& rhs) = default;
 
-        const value_type& operator[](const std::size_t idx) const {
-            return m_d[idx];
+        reference operator[](const std::size_t idx) const {
+            return m_d[idx * m_stride];
         }
 
-        value_type& operator[](const std::string& row_name) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.row_name == row_name) { return m_d[i]; }
-            }
-
-            std::cerr << "row name not found.";
-            abort();
-        }
-
-        const value_type& operator[](const std::string& row_name) const {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.row_name == row_name) { return m_d[i]; }
-            }
-
-            std::cerr << "row name not found.";
-            abort();
+        reference operator[](std::string_view row_name) const {
+            return (*this)[m_df->get_row_idx(row_name)];
         }
 
-        ColumnView& operator=(const ColumnView& rhs) {
-            if (this != &rhs) {
-                if (is_null()) {
-                    FORCED_ASSERT(m_d == nullptr, "m_d supposed to be null pointer, something is wrong");
-                    m_size = rhs.m_size;
-                    m_d    = new value_type[m_size];
-                } else {
-                    FORCED_ASSERT(m_size == rhs.m_size, "assignment operation on nonmatching size objects");
-                }
+        // writes the values of a Series or an expression into the column, an expression is evaluated without a temporary.
+        template<expression E>
+            requires(!std::is_same_v<std::remove_cvref_t<E>, ColumnView>)
+        ColumnView& operator=(const E& rhs) {
+            FORCED_ASSERT(m_d != nullptr, "m_d is not supposed to be null pointer, something is wrong");
+            FORCED_ASSERT(m_size == rhs.size(), "assignment operation on nonmatching size objects");
+            std::optional<Mask> valid = combined_validity(rhs);
+            if (is_contiguous()) {
+                evaluate_into(m_d, rhs);
+            } else {
                 for (std::size_t i = 0; i < m_size; i++) {
-                    m_d[i] = rhs[i];
+                    m_d[i * m_stride] = static_cast<data_type>(rhs[i]);
                 }
             }
+            // the column takes the validity of rhs, a column is only ever written through a view of a mutable frame.
+            if (valid || validity()) { mutable_frame()->set_validity(m_idx, std::move(valid)); }
             return *this;
         }
 
-        ColumnView& operator=(ColumnView&& rhs) {
-            FORCED_ASSERT(m_size == rhs.m_size, "assignment operation on nonmatching size objects");
-            m_size  = rhs.m_size;
-            m_d     = rhs.m_d;
-            rhs.m_d = nullptr;
+        // binary arithmetic and comparison operators build expressions, see df_expr.hpp.
+        // the compound assignments update the column in place in one pass, rhs is a value, a Series, another column or an expression.
+        // a value that is null in rhs becomes null.
+        template<typename Rhs>
+            requires(!std::is_const_v<ValueType> && (expression<Rhs> || std::convertible_to<Rhs, data_type>))
+        ColumnView& operator+=(const Rhs& rhs) {
+            apply_in_place<std::plus<>>(m_d, m_size, m_stride, rhs);
+            merge_validity(rhs);
             return *this;
         }
 
-        ColumnView& operator=(const Series<data_type>& rhs) {
-            FORCED_ASSERT(m_d != nullptr, "m_d is not supposed to be null pointer, something is wrong");
-            FORCED_ASSERT(m_size == rhs.size(), "assignment operation on nonmatching size objects");
-            for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i]->value = rhs[i];
-            }
+        template<typename Rhs>
+            requires(!std::is_const_v<ValueType> && (expression<Rhs> || std::convertible_to<Rhs, data_type>))
+        ColumnView& operator-=(const Rhs& rhs) {
+            apply_in_place<std::minus<>>(m_d, m_size, m_stride, rhs);
+            merge_validity(rhs);
             return *this;
         }
 
-        // comparaison operators
-        Series<bool> operator==(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i]->value == rhs[i]->value);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator==(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value == rhs[i]);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator==(const Series<data_type>& lhs, const ColumnView& rhs) {
-            return rhs == lhs;
-        }
-
-        friend Series<bool> operator==(const ColumnView& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value == rhs);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator==(const data_type& lhs, const ColumnView& rhs) {
-            return rhs == lhs;
-        }
-
-        Series<bool> operator!=(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i]->value != rhs[i]->value);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator!=(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value != rhs[i]);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator!=(const Series<data_type>& lhs, const ColumnView& rhs) {
-            return rhs != lhs;
-        }
-
-        friend Series<bool> operator!=(const ColumnView& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value != rhs);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator!=(const data_type& lhs, const ColumnView& rhs) {
-            return rhs != lhs;
-        }
-
-        Series<bool> operator>=(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i]->value >= rhs[i]->value);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator>=(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value >= rhs[i]);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator>=(const Series<data_type>& lhs, const ColumnView& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs[i] >= rhs[i]->value);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator>=(const ColumnView& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value >= rhs);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator>=(const data_type& lhs, const ColumnView& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs >= rhs[i]->value);
-            }
-            return temp;
-        }
-
-        Series<bool> operator<=(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i]->value <= rhs[i]->value);
-            }
-            return temp;
+        template<typename Rhs>
+            requires(!std::is_const_v<ValueType> && (expression<Rhs> || std::convertible_to<Rhs, data_type>))
+        ColumnView& operator*=(const Rhs& rhs) {
+            apply_in_place<std::multiplies<>>(m_d, m_size, m_stride, rhs);
+            merge_validity(rhs);
+            return *this;
         }
 
-        friend Series<bool> operator<=(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value <= rhs[i]);
-            }
-            return temp;
+        template<typename Rhs>
+            requires(!std::is_const_v<ValueType> && (expression<Rhs> || std::convertible_to<Rhs, data_type>))
+        ColumnView& operator/=(const Rhs& rhs) {
+            apply_in_place<std::divides<>>(m_d, m_size, m_stride, rhs);
+            merge_validity(rhs);
+            return *this;
         }
 
-        friend Series<bool> operator<=(const Series<data_type>& lhs, const ColumnView& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs[i] <= rhs[i]->value);
-            }
-            return temp;
+        ColumnView& operator++()
+            requires(!std::is_const_v<ValueType>)
+        {
+            return *this += data_type{1};
         }
 
-        friend Series<bool> operator<=(const ColumnView& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value <= rhs);
-            }
-            return temp;
+        ColumnView& operator--()
+            requires(!std::is_const_v<ValueType>)
+        {
+            return *this -= data_type{1};
         }
 
-        friend Series<bool> operator<=(const data_type& lhs, const ColumnView& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs <= rhs[i]->value);
-            }
-            return temp;
+        reference at_row(std::string_view row_name) const {
+            return (*this)[m_df->get_row_idx(row_name)];
         }
 
-        Series<bool> operator<(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i]->value < rhs[i]->value);
-            }
-            return temp;
+        template<std::enable_if_t<std::is_arithmetic_v<data_type>, bool> = true>
+        data_type max() const {
+            return df::extremum<true>(m_d, m_size, m_stride, valid_words());
         }
 
-        friend Series<bool> operator<(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value < rhs[i]);
-            }
-            return temp;
+        template<std::enable_if_t<std::is_arithmetic_v<data_type>, bool> = true>
+        data_type min() const {
+            return df::extremum<false>(m_d, m_size, m_stride, valid_words());
         }
 
-        friend Series<bool> operator<(const Series<data_type>& lhs, const ColumnView& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs[i] < rhs[i]->value);
-            }
-            return temp;
+        // validity of the column, see DataFrame::set_null().
+        bool is_valid(std::size_t idx) const {
+            const Mask* valid = validity();
+            return valid == nullptr || (*valid)[idx];
         }
 
-        friend Series<bool> operator<(const ColumnView& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value < rhs);
-            }
-            return temp;
+        Mask is_valid() const {
+            const Mask* valid = validity();
+            return valid ? *valid : Mask(m_size, true);
         }
 
-        friend Series<bool> operator<(const data_type& lhs, const ColumnView& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs < rhs[i]->value);
-            }
-            return temp;
+        // nullptr when every value of the column is valid.
+        const Mask* validity() const {
+            return m_df ? m_df->validity(m_idx) : nullptr;
         }
 
-        Series<bool> operator>(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i]->value > rhs[i]->value);
-            }
-            return temp;
+        bool has_nulls() const {
+            const Mask* valid = validity();
+            return valid && !valid->all();
         }
 
-        friend Series<bool> operator>(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value > rhs[i]);
-            }
-            return temp;
+        std::size_t null_count() const {
+            const Mask* valid = validity();
+            return valid ? m_size - valid->count() : 0;
         }
 
-        friend Series<bool> operator>(const Series<data_type>& lhs, const ColumnView& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "comparaison operation on nonmatching size objects");
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs[i] > rhs[i]->value);
-            }
-            return temp;
+        // reductions over the column, see df_reduce.hpp. null values are left out.
+        sum_t<data_type> sum(Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::sum(m_d, m_size, m_stride, valid_words(), mode);
         }
 
-        friend Series<bool> operator>(const ColumnView& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i]->value > rhs);
-            }
-            return temp;
+        double mean(Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::mean(m_d, m_size, m_stride, valid_words(), mode);
         }
 
-        friend Series<bool> operator>(const data_type& lhs, const ColumnView& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs > rhs[i]->value);
-            }
-            return temp;
+        double var(std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::var(m_d, m_size, m_stride, valid_words(), ddof, mode);
         }
 
-        // arithmetic operators
-        Series<data_type> operator+(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i]->value + rhs[i]->value;
-            }
-            return res;
+        double std(std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::stddev(m_d, m_size, m_stride, valid_words(), ddof, mode);
         }
 
-        friend Series<data_type> operator+(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i]->value + rhs[i];
-            }
-            return res;
+        // the same reductions split into fixed blocks, reproducible for any thread count, see reduction_block.
+        template<execution_policy Policy>
+        sum_t<data_type> sum(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::sum(policy, m_d, m_size, m_stride, valid_words(), mode);
         }
 
-        friend Series<data_type> operator+(const Series<data_type>& lhs, const ColumnView& rhs) {
-            return rhs + lhs;
+        template<execution_policy Policy>
+        double mean(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::mean(policy, m_d, m_size, m_stride, valid_words(), mode);
         }
 
-        // Column& operator+=(const T& rhs) {
-        //   for (std::size_t i = 0; i < m_size; i++) {
-        //     m_d[i]->value += rhs;
-        //   }
-        //   return *this;
-        // }
-
-        // Column& operator++() {
-        //   for (std::size_t i = 0; i < m_size; i++) {
-        //     ++m_d[i]->value;
-        //   }
-        //   return *this;
-        // }
-
-        Series<data_type> operator*(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i]->value * rhs[i]->value;
-            }
-            return res;
+        template<execution_policy Policy>
+        double var(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::var(policy, m_d, m_size, m_stride, valid_words(), ddof, mode);
         }
 
-        friend Series<data_type> operator*(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i]->value * rhs[i];
-            }
-            return res;
+        template<execution_policy Policy>
+        double std(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::stddev(policy, m_d, m_size, m_stride, valid_words(), ddof, mode);
         }
 
-        friend Series<data_type> operator*(const Series<data_type>& lhs, const ColumnView& rhs) {
-            return rhs * lhs;
+        template<execution_policy Policy>
+        data_type min(Policy policy) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::extremum<false>(policy, m_d, m_size, m_stride, valid_words());
         }
 
-        Series<data_type> operator-(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i]->value - rhs[i]->value;
-            }
-            return res;
+        template<execution_policy Policy>
+        data_type max(Policy policy) const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::extremum<true>(policy, m_d, m_size, m_stride, valid_words());
         }
 
-        friend Series<data_type> operator-(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i]->value - rhs[i];
-            }
-            return res;
+        sum_t<data_type> prod() const
+            requires(std::is_arithmetic_v<data_type>)
+        {
+            return df::prod(m_d, m_size, m_stride, valid_words());
         }
 
-        friend Series<data_type> operator-(const Series<data_type>& lhs, const ColumnView& rhs) {
-            FORCED_ASSERT(lhs.size() == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                res[i] = lhs[i] - rhs[i]->value;
-            }
-            return res;
-        }
-
-        // Column& operator-=(const T& rhs) {
-        //   for (std::size_t i = 0; i < m_size; i++) {
-        //     m_d[i]->value -= rhs;
-        //   }
-        //   return *this;
-        // }
-
-        // Column& operator--() {
-        //   for (std::size_t i = 0; i < m_size; i++) {
-        //     --m_d[i]->value;
-        //   }
-        //   return *this;
-        // }
-
-        Series<data_type> operator/(const ColumnView& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i]->value / rhs[i]->value;
-            }
-            return res;
+        std::size_t argmin() const
+            requires(std::totally_ordered<data_type>)
+        {
+            return df::argmin(m_d, m_size, m_stride, valid_words());
         }
 
-        friend Series<data_type> operator/(const ColumnView& lhs, const Series<data_type>& rhs) {
-            FORCED_ASSERT(lhs.m_size == rhs.size(), "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i]->value / rhs[i];
-            }
-            return res;
+        std::size_t argmax() const
+            requires(std::totally_ordered<data_type>)
+        {
+            return df::argmax(m_d, m_size, m_stride, valid_words());
         }
 
-        friend Series<data_type> operator/(const Series<data_type>& lhs, const ColumnView& rhs) {
-            FORCED_ASSERT(lhs.size() == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series<data_type> res(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                res[i] = lhs[i] / rhs[i]->value;
-            }
-            return res;
+        std::size_t count() const {
+            return df::count(m_d, m_size, m_stride, valid_words());
         }
 
-        value_type& at_row(const std::string& row_name) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.row_name == row_name) { return m_d[i]; }
-            }
-
-            std::cerr << "row name not found.";
-            abort();
+        // the k rows of the frame with the largest values in this column, largest first, see select_top_k(). null rows are left out.
+        group_type nlargest(std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return nlargest(execution::seq, k);
         }
 
-        const value_type& at_row(const std::string& row_name) const {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.row_name == row_name) { return m_d[i]; }
-            }
-
-            std::cerr << "row name not found.";
-            abort();
+        template<execution_policy Policy>
+        group_type nlargest(Policy policy, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return top_k(policy, k, true);
         }
 
-        template<std::enable_if_t<std::is_arithmetic_v<data_type>, bool> = true>
-        data_type max() const {
-            data_type temp = m_d[0]->value;
-            for (std::size_t i = 1; i < m_size; ++i) {
-                if (m_d[i]->value > temp) { temp = m_d[i]->value; }
-            }
-            return temp;
+        // the k rows of the frame with the smallest values in this column, smallest first.
+        group_type nsmallest(std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return nsmallest(execution::seq, k);
         }
 
-        template<std::enable_if_t<std::is_arithmetic_v<data_type>, bool> = true>
-        data_type min() const {
-            data_type temp = m_d[0]->value;
-            for (std::size_t i = 1; i < m_size; ++i) {
-                if (m_d[i]->value < temp) { temp = m_d[i]->value; }
-            }
-            return temp;
+        template<execution_policy Policy>
+        group_type nsmallest(Policy policy, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return top_k(policy, k, false);
         }
 
         Series<data_type> to_series() const {
             Series<data_type> data(m_size);
             for (std::size_t i = 0; i < m_size; i++) {
-                data[i] = m_d[i]->value;
+                data[i] = m_d[i * m_stride];
             }
+            if (const Mask* valid = validity()) { data.set_validity(*valid); }
             return data;
         }
 
@@ -531,20 +310,29 @@ namespace df {
             return m_stride;
         }
 
+        // a column of a column major frame is one contiguous block of values.
+        bool is_contiguous() const {
+            return m_stride == 1;
+        }
+
+        pointer data() const {
+            return m_d;
+        }
+
         std::size_t index() const {
-            return m_d[0]->idx.col_idx;
+            return m_idx;
         }
 
-        std::string name() const {
-            return m_d[0]->idx.col_name;
+        const std::string& name() const {
+            return m_df->get_col_name(m_idx);
         }
 
         iterator begin() const {
-            return iterator(m_d);
+            return iterator(m_d, static_cast<std::ptrdiff_t>(m_stride));
         }
 
         iterator end() const {
-            return iterator(m_d + m_size);
+            return iterator(m_d + (m_size * m_stride), static_cast<std::ptrdiff_t>(m_stride));
         }
 
         constexpr bool is_null() const {
@@ -552,9 +340,40 @@ namespace df {
         }
 
       private:
-        std::size_t m_size;
-        std::size_t m_stride;
-        value_type* m_d;
+        template<execution_policy Policy>
+        group_type top_k(Policy policy, std::size_t k, bool largest) const {
+            std::vector<std::size_t> rows(m_size);
+            std::iota(rows.begin(), rows.end(), std::size_t{0});
+            drop_null_rows(*this, rows);
+            select_top_k(policy, *this, rows, k, largest);
+            return group_type(mutable_frame(), std::move(rows));
+        }
+
+        // a mutable view is only ever created by a mutable frame.
+        typename group_type::dataframe_pointer mutable_frame() const {
+            return const_cast<typename group_type::dataframe_pointer>(m_df);
+        }
+
+        const std::uint64_t* valid_words() const {
+            const Mask* valid = validity();
+            return valid ? valid->words() : nullptr;
+        }
+
+        template<typename Rhs>
+        void merge_validity(const Rhs& rhs) {
+            if constexpr (expression<Rhs>) {
+                std::optional<Mask> valid = combined_validity(rhs);
+                if (!valid) { return; }
+                if (const Mask* own = validity()) { *valid &= *own; }
+                mutable_frame()->set_validity(m_idx, std::move(valid));
+            }
+        }
+
+        const DataFrame<data_type>* m_df;
+        std::size_t                 m_idx;
+        std::size_t                 m_size;
+        std::size_t                 m_stride;
+        pointer                     m_d;
     };
 } // namespace df
 
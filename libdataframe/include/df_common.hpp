@@ -5,13 +5,24 @@
 #include <optional>
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <ostream>
+#include <span>
 #include <stdlib.h>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #define DF_COLOR_R "\033[91m"
@@ -45,4 +56,24 @@
         }                                                                                                                                           \
     } while (false)
 
+// placed before a loop whose iterations do not depend on each other, lets the compiler vectorize it without alias checks.
+#if defined(__clang__)
+    #define DF_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+    #define DF_IVDEP _Pragma("GCC ivdep")
+#else
+    #define DF_IVDEP
+#endif
+
+namespace df {
+
+    // Physical order of the cells in the frame buffer. RowMajor keeps the cells of a row next to each other,
+    // ColumnMajor keeps each column in one contiguous block so column scans walk memory with a stride of 1.
+    enum class Layout {
+        RowMajor,
+        ColumnMajor
+    };
+
+} // namespace df
+
 #endif // DATA_FRAME_COMMON_H
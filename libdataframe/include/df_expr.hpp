@@ -0,0 +1,244 @@
+#ifndef DATA_FRAME_EXPR_H
+#define DATA_FRAME_EXPR_H
+
+#include "df_common.hpp"
+#include "df_simd.hpp"
+
+namespace df {
+    template<typename T>
+    class Series;
+
+    template<typename ValueType>
+    class ColumnView;
+
+    /*
+     arithmetic and comparison operators on Series and ColumnView do not compute anything, they return a BinaryExpr
+     node that holds its operands and computes element i on demand. a whole formula like a * b + c - d is a tree of
+     nodes, it is evaluated in one loop with a single output allocation when it is converted to a Series (or eval()),
+     or assigned to an existing Series/ColumnView without any allocation.
+
+     lvalue Series operands are held by reference, rvalue Series are moved into the node, views and nodes are copied.
+     an expression stored with auto must not outlive the lvalue Series it refers to.
+    */
+
+    template<typename T>
+    struct is_expression : std::false_type {};
+
+    template<typename T>
+    struct is_expression<Series<T>> : std::true_type {};
+
+    template<typename ValueType>
+    struct is_expression<ColumnView<ValueType>> : std::true_type {};
+
+    template<typename E>
+    concept expression = is_expression<std::remove_cvref_t<E>>::value;
+
+    template<expression E>
+    using expr_value_t = typename std::remove_cvref_t<E>::value_type;
+
+    // how an operand is stored inside a node.
+    template<typename E>
+    using expr_operand_t = std::conditional_t<std::is_lvalue_reference_v<E> && std::is_same_v<std::remove_cvref_t<E>, Series<expr_value_t<E>>>,
+                                              const Series<expr_value_t<E>>&,
+                                              std::remove_cvref_t<E>>;
+
+    template<typename T>
+    class ScalarExpr {
+      public:
+        using value_type = T;
+
+        explicit ScalarExpr(const T& value) : m_value(value) {
+        }
+
+        const T& operator[](std::size_t) const {
+            return m_value;
+        }
+
+        const T& value() const {
+            return m_value;
+        }
+
+      private:
+        T m_value;
+    };
+
+    template<typename T>
+    inline constexpr bool is_scalar_expr = false;
+
+    template<typename T>
+    inline constexpr bool is_scalar_expr<ScalarExpr<T>> = true;
+
+    template<typename Op, typename Lhs, typename Rhs>
+    class BinaryExpr {
+        using lhs_value_type = typename std::remove_cvref_t<Lhs>::value_type;
+        using rhs_value_type = typename std::remove_cvref_t<Rhs>::value_type;
+
+      public:
+        using value_type = std::conditional_t<std::is_same_v<decltype(Op{}(std::declval<lhs_value_type>(), std::declval<rhs_value_type>())), bool>,
+                                              bool,
+                                              std::common_type_t<lhs_value_type, rhs_value_type>>;
+
+        template<typename L, typename R>
+        BinaryExpr(L&& lhs, R&& rhs) : m_lhs(std::forward<L>(lhs)), m_rhs(std::forward<R>(rhs)) {
+            if constexpr (!is_scalar_expr<std::remove_cvref_t<Lhs>> && !is_scalar_expr<std::remove_cvref_t<Rhs>>) {
+                FORCED_ASSERT(m_lhs.size() == m_rhs.size(), "arithmetic operation on nonmatching size objects");
+            }
+        }
+
+        value_type operator[](std::size_t idx) const {
+            return static_cast<value_type>(Op{}(m_lhs[idx], m_rhs[idx]));
+        }
+
+        std::size_t size() const {
+            if constexpr (is_scalar_expr<std::remove_cvref_t<Lhs>>) {
+                return m_rhs.size();
+            } else {
+                return m_lhs.size();
+            }
+        }
+
+        Series<value_type> eval() const {
+            return Series<value_type>(*this);
+        }
+
+        const std::remove_cvref_t<Lhs>& lhs() const {
+            return m_lhs;
+        }
+
+        const std::remove_cvref_t<Rhs>& rhs() const {
+            return m_rhs;
+        }
+
+      private:
+        Lhs m_lhs;
+        Rhs m_rhs;
+    };
+
+    template<typename Op, typename Lhs, typename Rhs>
+    struct is_expression<BinaryExpr<Op, Lhs, Rhs>> : std::true_type {};
+
+    template<typename Op, expression L, expression R>
+    BinaryExpr<Op, expr_operand_t<L&&>, expr_operand_t<R&&>> make_binary_expr(L&& lhs, R&& rhs) {
+        return {std::forward<L>(lhs), std::forward<R>(rhs)};
+    }
+
+    template<typename Op, expression L>
+    BinaryExpr<Op, expr_operand_t<L&&>, ScalarExpr<expr_value_t<L>>> make_binary_expr(L&& lhs, const expr_value_t<L>& rhs) {
+        return {std::forward<L>(lhs), ScalarExpr<expr_value_t<L>>(rhs)};
+    }
+
+    template<typename Op, expression R>
+    BinaryExpr<Op, ScalarExpr<expr_value_t<R>>, expr_operand_t<R&&>> make_binary_expr(const expr_value_t<R>& lhs, R&& rhs) {
+        return {ScalarExpr<expr_value_t<R>>(lhs), std::forward<R>(rhs)};
+    }
+
+    // a leaf that a simd kernel can read, a contiguous buffer of T or a scalar.
+    template<typename T, typename E>
+    std::optional<simd::Operand<T>> simd_operand(const E& leaf) {
+        using leaf_type = std::remove_cvref_t<E>;
+        if constexpr (std::is_same_v<leaf_type, Series<T>>) {
+            return simd::Operand<T>::buffer(leaf.data());
+        } else if constexpr (std::is_same_v<leaf_type, ScalarExpr<T>>) {
+            return simd::Operand<T>::scalar(leaf.value());
+        } else if constexpr (std::is_same_v<leaf_type, ColumnView<T>> || std::is_same_v<leaf_type, ColumnView<const T>>) {
+            if (leaf.is_contiguous()) { return simd::Operand<T>::buffer(leaf.data()); }
+        }
+        return std::nullopt;
+    }
+
+    // writes expr[i] to out[0, expr.size()), out may alias the operands of expr.
+    template<typename Out, expression E>
+    void evaluate_into(Out* out, const E& expr) {
+        for (std::size_t i = 0; i < expr.size(); i++) {
+            out[i] = static_cast<Out>(expr[i]);
+        }
+    }
+
+    // a single node over contiguous leaves of one type runs through a simd kernel, deeper trees keep the fused loop.
+    template<typename Out, typename Op, typename Lhs, typename Rhs>
+    void evaluate_into(Out* out, const BinaryExpr<Op, Lhs, Rhs>& expr) {
+        using T = typename std::remove_cvref_t<Lhs>::value_type;
+        if constexpr (simd::has_kernel<Op, T> && std::is_same_v<T, typename std::remove_cvref_t<Rhs>::value_type>
+                      && std::is_same_v<Out, typename BinaryExpr<Op, Lhs, Rhs>::value_type>) {
+            auto lhs = simd_operand<T>(expr.lhs());
+            auto rhs = simd_operand<T>(expr.rhs());
+            if (lhs && rhs) {
+                simd::binary<Op>(*lhs, *rhs, out, expr.size());
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < expr.size(); i++) {
+            out[i] = static_cast<Out>(expr[i]);
+        }
+    }
+
+    // data[i * stride] = Op(data[i * stride], rhs[i]) in a single pass, the compound assignment operators of Series, ColumnView and
+    // DataFrame. rhs is a value applied to every element or an expression of size elements, contiguous data runs through simd::binary.
+    template<typename Op, typename T, typename Rhs>
+    void apply_in_place(T* data, std::size_t size, std::size_t stride, const Rhs& rhs) {
+        if constexpr (expression<Rhs>) {
+            FORCED_ASSERT(size == rhs.size(), "arithmetic operation on nonmatching size objects");
+        }
+        if constexpr (simd::has_kernel<Op, T>) {
+            if (stride == 1) {
+                std::optional<simd::Operand<T>> operand;
+                if constexpr (expression<Rhs>) {
+                    operand = simd_operand<T>(rhs);
+                } else {
+                    operand = simd::Operand<T>::scalar(static_cast<T>(rhs));
+                }
+                if (operand) {
+                    simd::binary<Op>(simd::Operand<T>::buffer(data), *operand, data, size);
+                    return;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < size; i++) {
+            T& value = data[i * stride];
+            if constexpr (expression<Rhs>) {
+                value = static_cast<T>(Op{}(value, rhs[i]));
+            } else {
+                value = static_cast<T>(Op{}(value, static_cast<T>(rhs)));
+            }
+        }
+    }
+
+    // data[i] = Op(data[i], rhs[i]) over two buffers of size elements.
+    template<typename Op, typename T>
+    void apply_in_place(T* data, const T* rhs, std::size_t size) {
+        if constexpr (simd::has_kernel<Op, T>) {
+            simd::binary<Op>(simd::Operand<T>::buffer(data), simd::Operand<T>::buffer(rhs), data, size);
+        } else {
+            for (std::size_t i = 0; i < size; i++) {
+                data[i] = static_cast<T>(Op{}(data[i], rhs[i]));
+            }
+        }
+    }
+
+// clang-format off
+#define DF_EXPR_BINARY_OPERATOR(OP, FUNCTOR)                                                                                              \
+    template<expression L, expression R>                                                                                                  \
+    auto operator OP(L&& lhs, R&& rhs) { return make_binary_expr<FUNCTOR>(std::forward<L>(lhs), std::forward<R>(rhs)); }                   \
+    template<expression L>                                                                                                                \
+    auto operator OP(L&& lhs, const expr_value_t<L>& rhs) { return make_binary_expr<FUNCTOR>(std::forward<L>(lhs), rhs); }                  \
+    template<expression R>                                                                                                                \
+    auto operator OP(const expr_value_t<R>& lhs, R&& rhs) { return make_binary_expr<FUNCTOR>(lhs, std::forward<R>(rhs)); }
+    // clang-format on
+
+    DF_EXPR_BINARY_OPERATOR(+, std::plus<>)
+    DF_EXPR_BINARY_OPERATOR(-, std::minus<>)
+    DF_EXPR_BINARY_OPERATOR(*, std::multiplies<>)
+    DF_EXPR_BINARY_OPERATOR(/, std::divides<>)
+
+    DF_EXPR_BINARY_OPERATOR(==, std::equal_to<>)
+    DF_EXPR_BINARY_OPERATOR(!=, std::not_equal_to<>)
+    DF_EXPR_BINARY_OPERATOR(<, std::less<>)
+    DF_EXPR_BINARY_OPERATOR(<=, std::less_equal<>)
+    DF_EXPR_BINARY_OPERATOR(>, std::greater<>)
+    DF_EXPR_BINARY_OPERATOR(>=, std::greater_equal<>)
+
+#undef DF_EXPR_BINARY_OPERATOR
+
+} // namespace df
+
+#endif // DATA_FRAME_EXPR_H
@@ -0,0 +1,135 @@
+#ifndef DATA_FRAME_LABEL_INDEX_H
+#define DATA_FRAME_LABEL_INDEX_H
+
+#include "df_common.hpp"
+
+namespace df {
+
+    // bidirectional mapping between labels (column or row names) and their positions.
+    // position -> name is a dense vector lookup, name -> position goes through an open addressing
+    // hash table (linear probing) keyed by std::string_view, so lookups never build a temporary std::string.
+    // when a name is inserted more than once the first position wins, like std::map::insert did.
+    class LabelIndex {
+        struct Slot {
+            std::size_t hash;
+            std::size_t pos;
+        };
+
+        static constexpr std::size_t empty_slot = std::numeric_limits<std::size_t>::max();
+
+      public:
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        LabelIndex() : m_mask(0), m_max_name_size(0) {
+        }
+
+        explicit LabelIndex(const std::vector<std::string>& names) : LabelIndex() {
+            reserve(names.size());
+            for (const auto& name : names) {
+                push_back(name);
+            }
+        }
+
+        // appends a name at position size(), returns that position.
+        std::size_t push_back(std::string name) {
+            if ((m_names.size() + 1) * 2 > m_slots.size()) { rehash(std::max<std::size_t>(16, m_slots.size() * 2)); }
+
+            std::size_t pos = m_names.size();
+            m_max_name_size = std::max(m_max_name_size, name.size());
+            m_names.push_back(std::move(name));
+            insert_slot(m_names.back(), pos);
+            return pos;
+        }
+
+        void reserve(std::size_t count) {
+            m_names.reserve(count);
+            std::size_t capacity = 16;
+            while (capacity < count * 2) {
+                capacity *= 2;
+            }
+            if (capacity > m_slots.size()) { rehash(capacity); }
+        }
+
+        void clear() noexcept {
+            m_names.clear();
+            m_slots.clear();
+            m_mask          = 0;
+            m_max_name_size = 0;
+        }
+
+        // position of name or npos.
+        std::size_t find(std::string_view name) const {
+            if (m_slots.empty()) { return npos; }
+
+            std::size_t hash = hash_of(name);
+            for (std::size_t i = hash & m_mask;; i = (i + 1) & m_mask) {
+                const Slot& slot = m_slots[i];
+                if (slot.pos == empty_slot) { return npos; }
+                if (slot.hash == hash && m_names[slot.pos] == name) { return slot.pos; }
+            }
+        }
+
+        std::size_t at(std::string_view name) const {
+            std::size_t pos = find(name);
+            if (pos == npos) { throw std::out_of_range("label not found: " + std::string(name)); }
+            return pos;
+        }
+
+        bool contains(std::string_view name) const {
+            return find(name) != npos;
+        }
+
+        const std::string& name(std::size_t pos) const {
+            return m_names[pos];
+        }
+
+        const std::vector<std::string>& names() const {
+            return m_names;
+        }
+
+        std::size_t size() const {
+            return m_names.size();
+        }
+
+        bool empty() const {
+            return m_names.empty();
+        }
+
+        std::size_t max_name_size() const {
+            return m_max_name_size;
+        }
+
+      private:
+        static std::size_t hash_of(std::string_view name) {
+            return std::hash<std::string_view>{}(name);
+        }
+
+        void insert_slot(std::string_view name, std::size_t pos) {
+            std::size_t hash = hash_of(name);
+            for (std::size_t i = hash & m_mask;; i = (i + 1) & m_mask) {
+                Slot& slot = m_slots[i];
+                if (slot.pos == empty_slot) {
+                    slot = {hash, pos};
+                    return;
+                }
+                if (slot.hash == hash && m_names[slot.pos] == name) { return; }
+            }
+        }
+
+        void rehash(std::size_t capacity) {
+            m_slots.assign(capacity, Slot{0, empty_slot});
+            m_mask = capacity - 1;
+            for (std::size_t pos = 0; pos < m_names.size(); pos++) {
+                insert_slot(m_names[pos], pos);
+            }
+        }
+
+        std::vector<std::string> m_names;
+        std::vector<Slot>        m_slots;
+        std::size_t              m_mask;
+        std::size_t              m_max_name_size;
+    };
+
+} // namespace df
+
+#endif // DATA_FRAME_LABEL_INDEX_H
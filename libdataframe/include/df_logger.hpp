@@ -2,6 +2,7 @@
 #define DATA_FRAME_LOGGER_H
 
 #include "df_common.hpp"
+#include "df_label_index.hpp"
 
 namespace df {
     template<typename T>
@@ -23,7 +24,7 @@ namespace df {
     class LoggingContext {
       public:
         using CellLoggingColorCond = std::function<std::string(const Cell<T>*)>;
-        using RowNameColorCond     = std::function<std::string(const RowView<Cell<T>>*)>;
+        using RowNameColorCond     = std::function<std::string(const RowView<T>*)>;
         using CellLoggingPrecCond  = std::function<int(const Cell<T>*)>;
 
         LoggingContext& with_exclude_columns(std::vector<std::string> column_names) {
@@ -74,7 +75,7 @@ namespace df {
         }
 
         CellLoggingColorCond     cell_color_condition     = [](const Cell<T>*) { return std::string(DF_COLOR_W); };
-        RowNameColorCond         row_name_color_condition = [](const RowView<Cell<T>>*) { return std::string(DF_COLOR_W); };
+        RowNameColorCond         row_name_color_condition = [](const RowView<T>*) { return std::string(DF_COLOR_W); };
         CellLoggingPrecCond      cell_precision_condition = [](const Cell<T>*) { return 8; };
         int                      floatPrecision           = 8;
         int                      spacing                  = 5;
@@ -98,6 +99,14 @@ namespace df {
             return *this;
         }
 
+        std::vector<bool> excluded_columns(const DataFrame<T>& df) const {
+            std::vector<bool> excluded(df.col_count(), false);
+            for (const auto& col_name : context.excluded_cols) {
+                if (std::size_t col_idx = df.col_labels().find(col_name); col_idx != LabelIndex::npos) { excluded[col_idx] = true; }
+            }
+            return excluded;
+        }
+
       public:
         LoggingContext<T> context;
 
@@ -130,19 +139,13 @@ namespace df {
             std::size_t row_name_space = this->context.max_row_name_size + this->context.spacing;
             int         col_spacing    = this->context.max_col_name_size + this->context.spacing;
 
-            auto contains = [](const std::vector<std::string>& excluded_cols_list, const std::string& cur_col_name) {
-                return std::find_if(excluded_cols_list.begin(),
-                                    excluded_cols_list.end(),
-                                    [cur_col_name](const std::string& col_name) { return cur_col_name == col_name; })
-                       != excluded_cols_list.end();
-            };
+            std::vector<bool> excluded = this->excluded_columns(*df);
 
             if (std::is_floating_point_v<T>) { std::cout.precision(this->context.floatPrecision + 1); }
 
             std::cout << std::left << std::setw(row_name_space + idx_space) << "idx";
             for (auto col_iter = df->iter_cols(); col_iter < df->end(); ++col_iter) {
-                std::string col_name = col_iter.current_col().name();
-                if (!contains(this->context.excluded_cols, col_name)) { std::cout << std::left << std::setw(col_spacing) << col_name; }
+                if (!excluded[col_iter.current_col_idx()]) { std::cout << std::left << std::setw(col_spacing) << col_iter.current_col().name(); }
             }
             std::cout << std::endl;
 
@@ -158,9 +161,10 @@ namespace df {
                 const auto& current_row = this->df->row(idx);
                 std::cout << std::left << std::setw(idx_space) << current_row.index() << this->context.row_name_color_condition(&current_row)
                           << std::left << std::setw(row_name_space) << current_row.name() << DF_COLOR_W;
-                for (const auto& cell : current_row) {
-                    if (!contains(this->context.excluded_cols, cell->idx.col_name)) {
-                        std::cout << this->context.cell_color_condition(cell) << std::left << std::setw(col_spacing) << cell->value << DF_COLOR_W;
+                for (std::size_t col_idx = 0; col_idx < current_row.size(); col_idx++) {
+                    if (!excluded[col_idx]) {
+                        const Cell<T> cell = df->cell(col_idx, current_row.index());
+                        std::cout << this->context.cell_color_condition(&cell) << std::left << std::setw(col_spacing) << cell.value << DF_COLOR_W;
                     }
                 }
                 std::cout << std::endl;
@@ -168,17 +172,19 @@ namespace df {
         }
     };
 
-    template<typename T>
+    // logger of a RowGroupView<Row>, Row is RowView<T> or RowView<const T>.
+    // the row color condition takes a mutable row, the rows of a group of const rows are printed without it.
+    template<typename T, typename Row = RowView<T>>
     class RowGroup_Logger : Logger<T> {
-        friend class RowGroupView<RowView<Cell<T>>>;
+        friend class RowGroupView<Row>;
 
-        RowGroup_Logger(RowGroupView<RowView<Cell<T>>>* rg) : Logger<T>(), rg(rg) {
+        RowGroup_Logger(const RowGroupView<Row>* rg) : Logger<T>(), rg(rg) {
         }
 
         RowGroup_Logger(const RowGroup_Logger& other) : Logger<T>(other.Logger), rg(other.rg) {
         }
 
-        RowGroupView<RowView<Cell<T>>>* rg;
+        const RowGroupView<Row>* rg;
 
       public:
         template<std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
@@ -191,18 +197,14 @@ namespace df {
             std::size_t row_name_space = this->context.max_row_name_size + this->context.spacing;
             int         col_spacing    = this->context.max_col_name_size + this->context.spacing;
 
-            auto contains = [](const std::vector<std::string>& excluded_cols_list, const std::string& cur_col_name) {
-                return std::find_if(excluded_cols_list.begin(),
-                                    excluded_cols_list.end(),
-                                    [cur_col_name](const std::string& col_name) { return cur_col_name == col_name; })
-                       != excluded_cols_list.end();
-            };
+            const DataFrame<T>& df       = *rg->dataframe();
+            std::vector<bool>   excluded = this->excluded_columns(df);
 
             if (std::is_floating_point_v<T>) { std::cout.precision(this->context.floatPrecision + 1); }
 
             std::cout << std::left << std::setw(row_name_space + idx_space) << "idx";
-            for (const auto& c : rg->at(0)) {
-                if (!contains(this->context.excluded_cols, c->idx.col_name)) { std::cout << std::left << std::setw(col_spacing) << c->idx.col_name; }
+            for (std::size_t col_idx = 0; col_idx < df.col_count(); col_idx++) {
+                if (!excluded[col_idx]) { std::cout << std::left << std::setw(col_spacing) << df.get_col_name(col_idx); }
             }
             std::cout << std::endl;
 
@@ -215,12 +217,15 @@ namespace df {
             }
 
             for (int idx = range_start; idx < range_end; idx++) {
-                const RowView<Cell<T>>& current_row = rg->at(idx);
-                std::cout << std::left << std::setw(idx_space) << current_row.index() << this->context.row_name_color_condition(&current_row)
-                          << std ::left << std::setw(row_name_space) << current_row.name() << DF_COLOR_W;
-                for (const auto& cell : current_row) {
-                    if (!contains(this->context.excluded_cols, cell->idx.col_name)) {
-                        std::cout << this->context.cell_color_condition(cell) << std::left << std::setw(col_spacing) << cell->value << DF_COLOR_W;
+                const Row   current_row = rg->at(idx);
+                std::string row_color   = DF_COLOR_W;
+                if constexpr (std::is_same_v<Row, RowView<T>>) { row_color = this->context.row_name_color_condition(&current_row); }
+                std::cout << std::left << std::setw(idx_space) << current_row.index() << row_color << std::left << std::setw(row_name_space)
+                          << current_row.name() << DF_COLOR_W;
+                for (std::size_t col_idx = 0; col_idx < current_row.size(); col_idx++) {
+                    if (!excluded[col_idx]) {
+                        const Cell<T> cell = df.cell(col_idx, current_row.index());
+                        std::cout << this->context.cell_color_condition(&cell) << std::left << std::setw(col_spacing) << cell.value << DF_COLOR_W;
                     }
                 }
                 std::cout << std::endl;
@@ -0,0 +1,252 @@
+#ifndef DATA_FRAME_MASK_H
+#define DATA_FRAME_MASK_H
+
+#include "df_common.hpp"
+#include "df_expr.hpp"
+#include "df_simd.hpp"
+
+namespace df {
+
+    /*
+     one bit per row packed into 64 bit words, the result of a comparison used for row selection.
+     a comparison expression converts to a Mask directly, e.g. Mask m = df["price"] > 100.0; single comparisons over
+     contiguous data are written through the simd kernels without a byte per element in between.
+     the bits past size() in the last word are always zero, so the bitwise operators and count() work word at a time.
+     a Mask is also the validity bitmap of a nullable Series or frame column, a set bit marks a valid value, see is_valid().
+    */
+    class Mask {
+      public:
+        using word_type                        = std::uint64_t;
+        static constexpr std::size_t word_bits = 64;
+
+        explicit Mask(std::size_t size, bool value = false) : m_words(word_count_for(size), value ? ~word_type{0} : word_type{0}), m_size(size) {
+            clear_padding();
+        }
+
+        Mask(const std::initializer_list<bool>& il) : Mask(il.size()) {
+            std::size_t idx = 0;
+            for (bool value : il) {
+                set(idx++, value);
+            }
+        }
+
+        // evaluates a boolean expression (a comparison, a Series<bool>) into bits.
+        template<expression E>
+            requires(std::is_same_v<expr_value_t<E>, bool>)
+        Mask(const E& expr) : Mask(expr.size()) {
+            evaluate_bits(expr);
+            and_validity(expr);
+        }
+
+        bool operator[](std::size_t idx) const {
+            return (m_words[idx / word_bits] >> (idx % word_bits)) & 1;
+        }
+
+        bool at(std::size_t idx) const {
+            if (idx >= m_size) { throw std::out_of_range("Mask index out of range: " + std::to_string(idx)); }
+            return (*this)[idx];
+        }
+
+        void set(std::size_t idx, bool value = true) {
+            word_type bit = word_type{1} << (idx % word_bits);
+            if (value) {
+                m_words[idx / word_bits] |= bit;
+            } else {
+                m_words[idx / word_bits] &= ~bit;
+            }
+        }
+
+        Mask& operator&=(const Mask& rhs) {
+            FORCED_ASSERT(m_size == rhs.m_size, "bitwise operation on nonmatching size masks");
+            for (std::size_t i = 0; i < m_words.size(); i++) {
+                m_words[i] &= rhs.m_words[i];
+            }
+            return *this;
+        }
+
+        Mask& operator|=(const Mask& rhs) {
+            FORCED_ASSERT(m_size == rhs.m_size, "bitwise operation on nonmatching size masks");
+            for (std::size_t i = 0; i < m_words.size(); i++) {
+                m_words[i] |= rhs.m_words[i];
+            }
+            return *this;
+        }
+
+        Mask& operator^=(const Mask& rhs) {
+            FORCED_ASSERT(m_size == rhs.m_size, "bitwise operation on nonmatching size masks");
+            for (std::size_t i = 0; i < m_words.size(); i++) {
+                m_words[i] ^= rhs.m_words[i];
+            }
+            return *this;
+        }
+
+        friend Mask operator&(Mask lhs, const Mask& rhs) {
+            return lhs &= rhs;
+        }
+
+        friend Mask operator|(Mask lhs, const Mask& rhs) {
+            return lhs |= rhs;
+        }
+
+        friend Mask operator^(Mask lhs, const Mask& rhs) {
+            return lhs ^= rhs;
+        }
+
+        friend Mask operator~(Mask mask) {
+            for (auto& word : mask.m_words) {
+                word = ~word;
+            }
+            mask.clear_padding();
+            return mask;
+        }
+
+        friend bool operator==(const Mask& lhs, const Mask& rhs) = default;
+
+        // number of set bits.
+        std::size_t count() const {
+            std::size_t count = 0;
+            for (word_type word : m_words) {
+                count += static_cast<std::size_t>(std::popcount(word));
+            }
+            return count;
+        }
+
+        bool any() const {
+            return std::any_of(m_words.begin(), m_words.end(), [](word_type word) { return word != 0; });
+        }
+
+        bool none() const {
+            return !any();
+        }
+
+        bool all() const {
+            return count() == m_size;
+        }
+
+        std::size_t size() const {
+            return m_size;
+        }
+
+        // new bits past the old size are set to value.
+        void resize(std::size_t size, bool value = false) {
+            std::size_t old_size = m_size;
+            m_words.resize(word_count_for(size), value ? ~word_type{0} : word_type{0});
+            m_size = size;
+            if (value && old_size % word_bits != 0 && size > old_size) { m_words[old_size / word_bits] |= ~word_type{0} << (old_size % word_bits); }
+            clear_padding();
+        }
+
+        std::size_t word_count() const {
+            return m_words.size();
+        }
+
+        const word_type* words() const {
+            return m_words.data();
+        }
+
+        // positions of the set bits in ascending order, the selection vector used by filter().
+        std::vector<std::size_t> indices() const {
+            std::vector<std::size_t> rows(count() + simd::mask_indices_slack);
+            rows.resize(simd::mask_indices(m_words.data(), m_words.size(), rows.data()));
+            return rows;
+        }
+
+        // defined in df_series.hpp.
+        Series<bool> to_series() const;
+
+        friend std::ostream& operator<<(std::ostream& os, const Mask& mask) {
+            for (std::size_t i = 0; i < mask.m_size; i++) {
+                os << (mask[i] ? '1' : '0');
+            }
+            return os;
+        }
+
+      private:
+        static std::size_t word_count_for(std::size_t size) {
+            return (size + word_bits - 1) / word_bits;
+        }
+
+        void clear_padding() {
+            if (m_size % word_bits != 0) { m_words.back() &= (word_type{1} << (m_size % word_bits)) - 1; }
+        }
+
+        template<typename E>
+        void evaluate_bits(const E& expr) {
+            for (std::size_t i = 0; i < m_size; i++) {
+                if (expr[i]) { m_words[i / word_bits] |= word_type{1} << (i % word_bits); }
+            }
+        }
+
+        template<typename Op, typename Lhs, typename Rhs>
+        void evaluate_bits(const BinaryExpr<Op, Lhs, Rhs>& expr) {
+            using T = typename std::remove_cvref_t<Lhs>::value_type;
+            if constexpr (simd::comparison_op<Op> && simd::vectorizable<T> && std::is_same_v<T, typename std::remove_cvref_t<Rhs>::value_type>) {
+                auto lhs = simd_operand<T>(expr.lhs());
+                auto rhs = simd_operand<T>(expr.rhs());
+                if (lhs && rhs) {
+                    simd::compare_bits<Op>(*lhs, *rhs, m_words.data(), m_size);
+                    return;
+                }
+            }
+            for (std::size_t i = 0; i < m_size; i++) {
+                if (expr[i]) { m_words[i / word_bits] |= word_type{1} << (i % word_bits); }
+            }
+        }
+
+        // a comparison with a null operand is not true, a row is only selected when every nullable leaf is valid.
+        template<typename E>
+        void and_validity(const E& expr);
+
+        std::vector<word_type> m_words;
+        std::size_t            m_size;
+    };
+
+    // the validity of an expression, valid where every nullable leaf (a Series or column with a validity bitmap) is valid.
+    // empty when no leaf has a bitmap, the result of the expression then has no nulls either.
+    template<typename E>
+    std::optional<Mask> combined_validity(const E& expr) {
+        using expr_type = std::remove_cvref_t<E>;
+        if constexpr (requires { expr.lhs(); expr.rhs(); }) {
+            std::optional<Mask> lhs = combined_validity(expr.lhs());
+            std::optional<Mask> rhs = combined_validity(expr.rhs());
+            if (lhs && rhs) { *lhs &= *rhs; }
+            return lhs ? std::move(lhs) : std::move(rhs);
+        } else if constexpr (!is_scalar_expr<expr_type> && requires { expr.validity(); }) {
+            if (const Mask* valid = expr.validity()) { return *valid; }
+        }
+        return std::nullopt;
+    }
+
+    template<typename E>
+    void Mask::and_validity(const E& expr) {
+        if (std::optional<Mask> valid = combined_validity(expr)) { *this &= *valid; }
+    }
+
+    // combining boolean expressions yields a Mask, e.g. (a > 1.0) & (b < 2.0).
+    template<expression L, expression R>
+        requires(std::is_same_v<expr_value_t<L>, bool> && std::is_same_v<expr_value_t<R>, bool>)
+    Mask operator&(const L& lhs, const R& rhs) {
+        return Mask(lhs) & Mask(rhs);
+    }
+
+    template<expression L, expression R>
+        requires(std::is_same_v<expr_value_t<L>, bool> && std::is_same_v<expr_value_t<R>, bool>)
+    Mask operator|(const L& lhs, const R& rhs) {
+        return Mask(lhs) | Mask(rhs);
+    }
+
+    template<expression L, expression R>
+        requires(std::is_same_v<expr_value_t<L>, bool> && std::is_same_v<expr_value_t<R>, bool>)
+    Mask operator^(const L& lhs, const R& rhs) {
+        return Mask(lhs) ^ Mask(rhs);
+    }
+
+    template<expression E>
+        requires(std::is_same_v<expr_value_t<E>, bool>)
+    Mask operator~(const E& expr) {
+        return ~Mask(expr);
+    }
+
+} // namespace df
+
+#endif // DATA_FRAME_MASK_H
@@ -0,0 +1,286 @@
+#ifndef DATA_FRAME_MMAP_H
+#define DATA_FRAME_MMAP_H
+
+#include "df.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace df {
+
+    /*
+     frame files hold the value buffer of a DataFrame as it is in memory, so a frame can be opened by mapping the file instead
+     of reading it:
+        header    MappedFileHeader, 64 bytes.
+        labels    the column names then the row names, each a 64 bit length followed by the characters.
+        values    col_count * row_count values in layout order, starting at a page aligned offset.
+     opening a file only reads the header and the labels, the values are paged in by the kernel when they are first touched.
+     the file is written in the byte order of the host.
+    */
+
+    enum class MapMode {
+        ReadOnly, // writing to the frame faults.
+        ReadWrite // writes go to the file, MAP_SHARED.
+    };
+
+    // access pattern hint for the kernel, see madvise(2).
+    enum class MapAdvice {
+        Normal,
+        Sequential,
+        Random,
+        WillNeed
+    };
+
+    // kind of the stored values, with value_size it tells an int64_t file from a double one.
+    enum class MappedValueKind : std::uint32_t {
+        Other, // any other trivially copyable type, only its size is checked.
+        Bool,
+        Signed,
+        Unsigned,
+        Float
+    };
+
+    template<typename T>
+    constexpr MappedValueKind mapped_value_kind() {
+        if constexpr (std::is_same_v<T, bool>) {
+            return MappedValueKind::Bool;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return MappedValueKind::Float;
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return MappedValueKind::Signed;
+        } else if constexpr (std::is_integral_v<T>) {
+            return MappedValueKind::Unsigned;
+        } else {
+            return MappedValueKind::Other;
+        }
+    }
+
+    struct MappedFileHeader {
+        static constexpr std::array<char, 8> file_magic   = {'D', 'F', 'F', 'R', 'A', 'M', 'E', '\0'};
+        static constexpr std::uint32_t       file_version = 2;
+
+        std::array<char, 8> magic;
+        std::uint32_t       version;
+        std::uint32_t       value_size;
+        std::uint32_t       layout;
+        std::uint32_t       value_kind; // a MappedValueKind.
+        std::uint64_t       col_count;
+        std::uint64_t       row_count;
+        std::uint64_t       labels_size;
+        std::uint64_t       values_offset;
+        std::uint64_t       values_size;
+    };
+
+    static_assert(sizeof(MappedFileHeader) <= 64 && std::is_trivially_copyable_v<MappedFileHeader>);
+
+    inline constexpr std::size_t mapped_header_size  = 64;
+    inline constexpr std::size_t mapped_values_align = 4096;
+
+    namespace detail {
+        // a * b and a + b of header fields, false when the result does not fit in 64 bits.
+        inline bool checked_mul(std::uint64_t a, std::uint64_t b, std::uint64_t& result) {
+            if (a != 0 && b > std::numeric_limits<std::uint64_t>::max() / a) { return false; }
+            result = a * b;
+            return true;
+        }
+
+        inline bool checked_add(std::uint64_t a, std::uint64_t b, std::uint64_t& result) {
+            if (b > std::numeric_limits<std::uint64_t>::max() - a) { return false; }
+            result = a + b;
+            return true;
+        }
+    } // namespace detail
+
+    // a whole file mapped into memory, unmapped when destroyed.
+    class MappedFile {
+      public:
+        MappedFile(const std::filesystem::path& path, MapMode mode) {
+#if defined(_WIN32)
+            (void)path;
+            (void)mode;
+            throw std::runtime_error("memory mapped frames need a POSIX system");
+#else
+            m_writable = mode == MapMode::ReadWrite;
+            int fd     = ::open(path.c_str(), m_writable ? O_RDWR : O_RDONLY);
+            if (fd < 0) { throw std::system_error(errno, std::generic_category(), "open " + path.string()); }
+
+            struct stat info {};
+            if (::fstat(fd, &info) != 0) {
+                int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "stat " + path.string());
+            }
+            m_size = static_cast<std::size_t>(info.st_size);
+            if (m_size == 0) {
+                ::close(fd);
+                throw std::runtime_error("empty frame file: " + path.string());
+            }
+
+            void* base = ::mmap(nullptr, m_size, m_writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+            int   error = errno;
+            // the mapping keeps the file open.
+            ::close(fd);
+            if (base == MAP_FAILED) { throw std::system_error(error, std::generic_category(), "mmap " + path.string()); }
+            m_base = static_cast<std::byte*>(base);
+#endif
+        }
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // a writable mapping is flushed to the file before it is unmapped.
+        ~MappedFile() {
+#if !defined(_WIN32)
+            if (m_writable) { ::msync(m_base, m_size, MS_SYNC); }
+            ::munmap(m_base, m_size);
+#endif
+        }
+
+        std::byte* data() const {
+            return m_base;
+        }
+
+        std::size_t size() const {
+            return m_size;
+        }
+
+        // hints the access pattern of [offset, offset + size), offset rounded down to the page.
+        void advise(std::size_t offset, std::size_t size, MapAdvice advice) const {
+#if !defined(_WIN32)
+            int flag = MADV_NORMAL;
+            switch (advice) {
+                case MapAdvice::Normal: flag = MADV_NORMAL; break;
+                case MapAdvice::Sequential: flag = MADV_SEQUENTIAL; break;
+                case MapAdvice::Random: flag = MADV_RANDOM; break;
+                case MapAdvice::WillNeed: flag = MADV_WILLNEED; break;
+            }
+            std::size_t page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            std::size_t first = offset - (offset % page);
+            if (size > 0) { ::madvise(m_base + first, size + (offset - first), flag); }
+#else
+            (void)offset;
+            (void)size;
+            (void)advice;
+#endif
+        }
+
+      private:
+        std::byte*  m_base     = nullptr;
+        std::size_t m_size     = 0;
+        bool        m_writable = false;
+    };
+
+    // writes df as a frame file, see open_mapped_file().
+    template<typename T>
+        requires(std::is_trivially_copyable_v<T>)
+    void write_mapped_file(const DataFrame<T>& df, const std::filesystem::path& path) {
+        std::string labels;
+        auto        append_label = [&labels](const std::string& name) {
+            std::uint64_t length = name.size();
+            labels.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            labels.append(name);
+        };
+        for (std::size_t col_idx = 0; col_idx < df.col_count(); col_idx++) {
+            append_label(df.col_labels().name(col_idx));
+        }
+        for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+            append_label(df.row_labels().name(row_idx));
+        }
+
+        MappedFileHeader header{};
+        header.magic         = MappedFileHeader::file_magic;
+        header.version       = MappedFileHeader::file_version;
+        header.value_size    = sizeof(T);
+        header.layout        = static_cast<std::uint32_t>(df.layout());
+        header.value_kind    = static_cast<std::uint32_t>(mapped_value_kind<T>());
+        header.col_count     = df.col_count();
+        header.row_count     = df.row_count();
+        header.labels_size   = labels.size();
+        header.values_offset = ((mapped_header_size + labels.size() + mapped_values_align - 1) / mapped_values_align) * mapped_values_align;
+        header.values_size   = df.size() * sizeof(T);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) { throw std::runtime_error("cannot write frame file: " + path.string()); }
+        std::array<char, mapped_header_size> header_bytes{};
+        std::memcpy(header_bytes.data(), &header, sizeof(header));
+        file.write(header_bytes.data(), header_bytes.size());
+        file.write(labels.data(), static_cast<std::streamsize>(labels.size()));
+        std::string padding(header.values_offset - mapped_header_size - labels.size(), '\0');
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        file.write(reinterpret_cast<const char*>(df.data()), static_cast<std::streamsize>(header.values_size));
+        if (!file.flush()) { throw std::runtime_error("cannot write frame file: " + path.string()); }
+    }
+
+    // a frame whose value buffer is the mapped file, the mapping lives as long as the frame and the frames it was moved to.
+    // copies of the frame, and the frame itself once it has to grow, hold their values in memory and no longer see the file.
+    template<typename T>
+        requires(std::is_trivially_copyable_v<T>)
+    DataFrame<T> open_mapped_file(const std::filesystem::path& path, MapMode mode = MapMode::ReadOnly, MapAdvice advice = MapAdvice::Normal) {
+        auto mapping = std::make_shared<MappedFile>(path, mode);
+
+        MappedFileHeader header;
+        if (mapping->size() < mapped_header_size) { throw std::runtime_error("not a frame file: " + path.string()); }
+        std::memcpy(&header, mapping->data(), sizeof(header));
+        if (header.magic != MappedFileHeader::file_magic || header.version != MappedFileHeader::file_version) {
+            throw std::runtime_error("not a frame file: " + path.string());
+        }
+        if (header.value_size != sizeof(T) || header.value_kind != static_cast<std::uint32_t>(mapped_value_kind<T>())) {
+            throw std::runtime_error("frame file value type does not match the frame type: " + path.string());
+        }
+        if (header.layout != static_cast<std::uint32_t>(Layout::RowMajor) && header.layout != static_cast<std::uint32_t>(Layout::ColumnMajor)) {
+            throw std::runtime_error("unknown frame file layout: " + path.string());
+        }
+
+        // every size is checked for overflow, and every label takes at least its 64 bit length, before anything is allocated.
+        std::uint64_t value_count   = 0;
+        std::uint64_t values_size   = 0;
+        std::uint64_t values_end    = 0;
+        std::uint64_t labels_extent = 0;
+        std::uint64_t max_labels    = header.labels_size / sizeof(std::uint64_t);
+        if (!detail::checked_mul(header.col_count, header.row_count, value_count) || !detail::checked_mul(value_count, sizeof(T), values_size)
+            || !detail::checked_add(header.values_offset, header.values_size, values_end)
+            || !detail::checked_add(mapped_header_size, header.labels_size, labels_extent) || header.values_size != values_size
+            || header.values_offset % alignof(T) != 0 || values_end > mapping->size() || labels_extent > header.values_offset
+            || header.col_count > max_labels || header.row_count > max_labels - header.col_count) {
+            throw std::runtime_error("truncated or corrupt frame file: " + path.string());
+        }
+
+        const std::byte* labels     = mapping->data() + mapped_header_size;
+        const std::byte* labels_end = labels + header.labels_size;
+        auto             read_label = [&labels, labels_end, &path]() {
+            std::uint64_t length = 0;
+            if (labels_end - labels < static_cast<std::ptrdiff_t>(sizeof(length))) { throw std::runtime_error("corrupt frame file labels: " + path.string()); }
+            std::memcpy(&length, labels, sizeof(length));
+            labels += sizeof(length);
+            if (static_cast<std::uint64_t>(labels_end - labels) < length) { throw std::runtime_error("corrupt frame file labels: " + path.string()); }
+            std::string name(reinterpret_cast<const char*>(labels), length);
+            labels += length;
+            return name;
+        };
+        std::vector<std::string> col_names(header.col_count);
+        std::vector<std::string> row_names(header.row_count);
+        for (auto& name : col_names) {
+            name = read_label();
+        }
+        for (auto& name : row_names) {
+            name = read_label();
+        }
+
+        mapping->advise(header.values_offset, header.values_size, advice);
+        T*     values = reinterpret_cast<T*>(mapping->data() + header.values_offset);
+        Layout layout = static_cast<Layout>(header.layout);
+        return DataFrame<T>(col_names, row_names, layout, values, std::move(mapping));
+    }
+
+} // namespace df
+
+#endif // DATA_FRAME_MMAP_H
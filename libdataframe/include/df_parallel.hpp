@@ -0,0 +1,106 @@
+#ifndef DATA_FRAME_PARALLEL_H
+#define DATA_FRAME_PARALLEL_H
+
+#include "df_common.hpp"
+#include "df_thread_pool.hpp"
+
+namespace df {
+
+    namespace execution {
+        struct sequenced_policy {};
+
+        // thread_count 0 means one thread per hardware thread.
+        struct parallel_policy {
+            std::size_t thread_count = 0;
+
+            constexpr parallel_policy with_threads(std::size_t count) const {
+                return parallel_policy{count};
+            }
+        };
+
+        // parallel chunks whose loops are also marked free of loop carried dependencies for the vectorizer, see DF_IVDEP.
+        // the element function must not synchronize with other elements. everything taking a parallel_policy accepts it.
+        struct parallel_unsequenced_policy : parallel_policy {
+            constexpr parallel_unsequenced_policy with_threads(std::size_t count) const {
+                return parallel_unsequenced_policy{{count}};
+            }
+        };
+
+        inline constexpr sequenced_policy            seq{};
+        inline constexpr parallel_policy             par{};
+        inline constexpr parallel_unsequenced_policy par_unseq{};
+    } // namespace execution
+
+    template<typename T>
+    concept execution_policy = std::same_as<std::remove_cvref_t<T>, execution::sequenced_policy>
+                            || std::derived_from<std::remove_cvref_t<T>, execution::parallel_policy>;
+
+    template<typename T>
+    inline constexpr bool is_parallel_policy_v = std::derived_from<std::remove_cvref_t<T>, execution::parallel_policy>;
+
+    template<typename T>
+    inline constexpr bool is_unsequenced_policy_v = std::same_as<std::remove_cvref_t<T>, execution::parallel_unsequenced_policy>;
+
+    // fewest values per thread for the parallel loops over a buffer, below that the threads cost more than they save.
+    inline constexpr std::size_t parallel_grain = 1 << 16;
+
+    // splits [begin, end) into at most thread_count contiguous chunks and calls fn(chunk_begin, chunk_end) for each one.
+    // the calling thread runs the first chunk, the others go to default_pool(), and the caller runs queued pool tasks while it
+    // waits, so parallel_for can be nested. the chunk boundaries only depend on the range and the thread count.
+    // the first exception thrown by a chunk is rethrown once all chunks are done.
+    template<typename Fn>
+    void parallel_for(std::size_t begin, std::size_t end, Fn&& fn, std::size_t thread_count = 0) {
+        if (end <= begin) { return; }
+        std::size_t size   = end - begin;
+        std::size_t chunks = std::min(resolve_thread_count(thread_count), size);
+        if (chunks == 1) {
+            fn(begin, end);
+            return;
+        }
+
+        // owned by the tasks as well, a worker may still be inside notify_all() when the caller returns.
+        struct State {
+            explicit State(std::size_t chunks) : remaining(chunks), errors(chunks) {
+            }
+
+            std::atomic<std::size_t>        remaining;
+            std::vector<std::exception_ptr> errors;
+        };
+        auto state     = std::make_shared<State>(chunks);
+        auto run_chunk = [state, &fn, begin, size, chunks](std::size_t chunk) {
+            try {
+                fn(begin + ((size * chunk) / chunks), begin + ((size * (chunk + 1)) / chunks));
+            } catch (...) {
+                state->errors[chunk] = std::current_exception();
+            }
+            if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) { state->remaining.notify_all(); }
+        };
+
+        ThreadPool& pool = default_pool();
+        for (std::size_t chunk = 1; chunk < chunks; chunk++) {
+            pool.submit([run_chunk, chunk] { run_chunk(chunk); });
+        }
+        run_chunk(0);
+        for (std::size_t left = state->remaining.load(std::memory_order_acquire); left != 0; left = state->remaining.load(std::memory_order_acquire)) {
+            if (!pool.run_pending_task()) { state->remaining.wait(left, std::memory_order_acquire); }
+        }
+
+        for (auto& error : state->errors) {
+            if (error) { std::rethrow_exception(error); }
+        }
+    }
+
+    // fn(chunk_begin, chunk_end) over [begin, end) under policy, at most one chunk per grain values.
+    // the sequenced policy calls fn(begin, end) on the calling thread.
+    template<execution_policy Policy, typename Fn>
+    void parallel_for(Policy policy, std::size_t begin, std::size_t end, Fn&& fn, std::size_t grain = parallel_grain) {
+        std::size_t thread_count = 1;
+        if constexpr (is_parallel_policy_v<Policy>) {
+            thread_count = std::min(resolve_thread_count(policy.thread_count), (end - std::min(begin, end)) / std::max<std::size_t>(grain, 1));
+        }
+        parallel_for(begin, end, std::forward<Fn>(fn), std::max<std::size_t>(thread_count, 1));
+    }
+
+} // namespace df
+
+#endif // DATA_FRAME_PARALLEL_H
@@ -0,0 +1,514 @@
+#ifndef DATA_FRAME_REDUCE_H
+#define DATA_FRAME_REDUCE_H
+
+#include "df_common.hpp"
+#include "df_parallel.hpp"
+#include "df_simd.hpp"
+
+namespace df {
+
+    /*
+     reductions over a strided run of values, stride 1 for a Series or a column major column, the row size for a row major column.
+     contiguous float/double data runs through the simd kernels, everything else through plain loops.
+     floating point sums take a Summation mode:
+        Naive     one running sum per accumulator, fastest, the error grows with the size.
+        Pairwise  sums blocks of pairwise_block values and adds the block sums as a tree, the error grows with log2(size). the default.
+        Kahan     Neumaier compensated sum, the error does not grow with the size, about twice the work of Naive.
+     integer sums are exact in 64 bits and ignore the mode.
+    */
+
+    enum class Summation {
+        Naive,
+        Pairwise,
+        Kahan
+    };
+
+    template<typename T>
+    using sum_t = std::conditional_t<std::is_floating_point_v<T>, T, std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+    inline constexpr std::size_t pairwise_block = 256;
+
+    namespace detail {
+        template<simd::Fold F, typename Acc, typename T>
+        Acc fold_term(const T& value, Acc center) {
+            Acc x = static_cast<Acc>(value);
+            if constexpr (F == simd::Fold::SquaredDeviation) {
+                return (x - center) * (x - center);
+            } else {
+                return x;
+            }
+        }
+
+        template<simd::Fold F, typename Acc, typename T>
+        Acc strided_pairwise_sum(const T* data, std::size_t size, std::size_t stride, Acc center) {
+            if (size <= pairwise_block) {
+                Acc sum = 0;
+                for (std::size_t i = 0; i < size; i++) {
+                    sum += fold_term<F>(data[i * stride], center);
+                }
+                return sum;
+            }
+            std::size_t half = size / 2;
+            return strided_pairwise_sum<F>(data, half, stride, center) + strided_pairwise_sum<F>(data + (half * stride), size - half, stride, center);
+        }
+
+        template<simd::Fold F, typename Acc, typename T>
+        Acc strided_sum(const T* data, std::size_t size, std::size_t stride, Acc center, Summation mode) {
+            if constexpr (std::is_floating_point_v<Acc>) {
+                switch (mode) {
+                    case Summation::Naive: break;
+                    case Summation::Pairwise: return strided_pairwise_sum<F>(data, size, stride, center);
+                    case Summation::Kahan: {
+                        // float is compensated in double, like the simd kernel.
+                        using wide = std::conditional_t<std::is_same_v<Acc, float>, double, Acc>;
+                        wide sum   = 0;
+                        wide comp  = 0;
+                        for (std::size_t i = 0; i < size; i++) {
+                            simd::detail::neumaier_add(sum, comp, fold_term<F>(data[i * stride], static_cast<wide>(center)));
+                        }
+                        return static_cast<Acc>(sum + comp);
+                    }
+                }
+            }
+            Acc sum = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                sum += fold_term<F>(data[i * stride], center);
+            }
+            return sum;
+        }
+
+        template<simd::Fold F, simd::reducible T>
+        T contiguous_sum(const T* data, std::size_t size, T center, Summation mode) {
+            switch (mode) {
+                case Summation::Naive: return simd::reduce<F>(data, size, center);
+                case Summation::Kahan: return simd::compensated_reduce<F>(data, size, center);
+                case Summation::Pairwise: break;
+            }
+            if (size <= pairwise_block) { return simd::reduce<F>(data, size, center); }
+            std::size_t half = size / 2;
+            return contiguous_sum<F>(data, half, center, mode) + contiguous_sum<F>(data + half, size - half, center, mode);
+        }
+
+        // sum of the values (Fold::Sum) or of their squared deviations from center (Fold::SquaredDeviation).
+        template<simd::Fold F, typename Acc, typename T>
+        Acc sum(const T* data, std::size_t size, std::size_t stride, Acc center, Summation mode) {
+            if constexpr (simd::reducible<T> && std::is_same_v<Acc, T>) {
+                if (stride == 1) { return contiguous_sum<F>(data, size, center, mode); }
+            }
+            return strided_sum<F>(data, size, stride, center, mode);
+        }
+
+        template<typename T>
+        using variance_acc_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+    } // namespace detail
+
+    template<typename T>
+    sum_t<T> sum(const T* data, std::size_t size, std::size_t stride = 1, Summation mode = Summation::Pairwise) {
+        return detail::sum<simd::Fold::Sum>(data, size, stride, sum_t<T>{}, mode);
+    }
+
+    // NaN for an empty run.
+    template<typename T>
+    double mean(const T* data, std::size_t size, std::size_t stride = 1, Summation mode = Summation::Pairwise) {
+        return static_cast<double>(sum(data, size, stride, mode)) / static_cast<double>(size);
+    }
+
+    // two passes, the mean then the squared deviations from it. ddof 1 is the sample variance, 0 the population variance.
+    // NaN when size <= ddof.
+    template<typename T>
+    double var(const T* data, std::size_t size, std::size_t stride = 1, std::size_t ddof = 1, Summation mode = Summation::Pairwise) {
+        if (size <= ddof) { return std::numeric_limits<double>::quiet_NaN(); }
+        using acc_type = detail::variance_acc_t<T>;
+        auto center    = static_cast<acc_type>(mean(data, size, stride, mode));
+        auto deviation = detail::sum<simd::Fold::SquaredDeviation>(data, size, stride, center, mode);
+        return static_cast<double>(deviation) / static_cast<double>(size - ddof);
+    }
+
+    template<typename T>
+    double stddev(const T* data, std::size_t size, std::size_t stride = 1, std::size_t ddof = 1, Summation mode = Summation::Pairwise) {
+        return std::sqrt(var(data, size, stride, ddof, mode));
+    }
+
+    template<typename T>
+    sum_t<T> prod(const T* data, std::size_t size, std::size_t stride = 1) {
+        if constexpr (simd::reducible<T>) {
+            if (stride == 1) { return simd::reduce<simd::Fold::Product>(data, size); }
+        }
+        sum_t<T> product = 1;
+        for (std::size_t i = 0; i < size; i++) {
+            product *= static_cast<sum_t<T>>(data[i * stride]);
+        }
+        return product;
+    }
+
+    // position of the first smallest (Max = false) or largest value. NaNs are skipped, a run of NaNs only gives 0.
+    template<bool Max, typename T>
+    std::size_t arg_extremum(const T* data, std::size_t size, std::size_t stride = 1) {
+        FORCED_ASSERT(size > 0, "argmin/argmax of an empty range");
+        if constexpr (simd::vectorizable<T>) {
+            if (stride == 1) {
+                T best = Max ? simd::max(data, size) : simd::min(data, size);
+                if constexpr (std::is_floating_point_v<T>) {
+                    if (best != best) { return 0; }
+                }
+                return static_cast<std::size_t>(std::find(data, data + size, best) - data);
+            }
+        }
+        std::size_t best = 0;
+        for (std::size_t i = 1; i < size; i++) {
+            if (simd::detail::improves<Max>(data[i * stride], data[best * stride])) { best = i; }
+        }
+        return best;
+    }
+
+    template<typename T>
+    std::size_t argmin(const T* data, std::size_t size, std::size_t stride = 1) {
+        return arg_extremum<false>(data, size, stride);
+    }
+
+    template<typename T>
+    std::size_t argmax(const T* data, std::size_t size, std::size_t stride = 1) {
+        return arg_extremum<true>(data, size, stride);
+    }
+
+    // smallest (Max = false) or largest value of a non empty run, NaN only when every value is NaN.
+    template<bool Max, typename T>
+    T extremum(const T* data, std::size_t size, std::size_t stride = 1) {
+        FORCED_ASSERT(size > 0, "min/max of an empty range");
+        if constexpr (simd::vectorizable<T>) {
+            if (stride == 1) { return Max ? simd::max(data, size) : simd::min(data, size); }
+        }
+        T best = data[0];
+        for (std::size_t i = 1; i < size; i++) {
+            if (simd::detail::improves<Max>(data[i * stride], best)) { best = data[i * stride]; }
+        }
+        return best;
+    }
+
+    /*
+     the policy overloads cut the run into blocks of reduction_block values whatever the thread count, reduce every block on
+     its own and combine the block results in block order, the same way the mode combines values. seq and par therefore give
+     the same bits for any thread count. they can differ in the last bits from the overloads without a policy, which do not
+     cut blocks.
+    */
+    inline constexpr std::size_t reduction_block = 1 << 15;
+
+    namespace detail {
+        template<typename Acc>
+        Acc combine_blocks(const Acc* partials, std::size_t count, Summation mode) {
+            return strided_sum<simd::Fold::Sum>(partials, count, 1, Acc{}, mode);
+        }
+
+        template<simd::Fold F, typename Acc, execution_policy Policy, typename T>
+        Acc blocked_sum(Policy policy, const T* data, std::size_t size, std::size_t stride, Acc center, Summation mode) {
+            std::size_t      blocks = (size + reduction_block - 1) / reduction_block;
+            std::vector<Acc> partials(blocks);
+            parallel_for(
+            policy,
+            0,
+            blocks,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t block = first; block < last; block++) {
+                    std::size_t begin = block * reduction_block;
+                    partials[block]   = sum<F>(data + (begin * stride), std::min(reduction_block, size - begin), stride, center, mode);
+                }
+            },
+            1);
+            return combine_blocks(partials.data(), blocks, mode);
+        }
+    } // namespace detail
+
+    template<execution_policy Policy, typename T>
+    sum_t<T> sum(Policy policy, const T* data, std::size_t size, std::size_t stride = 1, Summation mode = Summation::Pairwise) {
+        return detail::blocked_sum<simd::Fold::Sum>(policy, data, size, stride, sum_t<T>{}, mode);
+    }
+
+    template<execution_policy Policy, typename T>
+    double mean(Policy policy, const T* data, std::size_t size, std::size_t stride = 1, Summation mode = Summation::Pairwise) {
+        return static_cast<double>(sum(policy, data, size, stride, mode)) / static_cast<double>(size);
+    }
+
+    template<execution_policy Policy, typename T>
+    double var(Policy policy, const T* data, std::size_t size, std::size_t stride = 1, std::size_t ddof = 1, Summation mode = Summation::Pairwise) {
+        if (size <= ddof) { return std::numeric_limits<double>::quiet_NaN(); }
+        using acc_type = detail::variance_acc_t<T>;
+        auto center    = static_cast<acc_type>(mean(policy, data, size, stride, mode));
+        auto deviation = detail::blocked_sum<simd::Fold::SquaredDeviation>(policy, data, size, stride, center, mode);
+        return static_cast<double>(deviation) / static_cast<double>(size - ddof);
+    }
+
+    template<execution_policy Policy, typename T>
+    double stddev(Policy policy, const T* data, std::size_t size, std::size_t stride = 1, std::size_t ddof = 1, Summation mode = Summation::Pairwise) {
+        return std::sqrt(var(policy, data, size, stride, ddof, mode));
+    }
+
+    template<bool Max, execution_policy Policy, typename T>
+    T extremum(Policy policy, const T* data, std::size_t size, std::size_t stride = 1) {
+        FORCED_ASSERT(size > 0, "min/max of an empty range");
+        std::size_t    blocks = (size + reduction_block - 1) / reduction_block;
+        std::vector<T> partials(blocks);
+        parallel_for(
+        policy,
+        0,
+        blocks,
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t block = first; block < last; block++) {
+                std::size_t begin = block * reduction_block;
+                partials[block]   = extremum<Max>(data + (begin * stride), std::min(reduction_block, size - begin), stride);
+            }
+        },
+        1);
+        return extremum<Max>(partials.data(), blocks);
+    }
+
+    // number of values that are not NaN.
+    template<typename T>
+    std::size_t count(const T* data, std::size_t size, std::size_t stride = 1) {
+        if constexpr (std::is_floating_point_v<T>) {
+            std::size_t valid = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                valid += static_cast<std::size_t>(!std::isnan(data[i * stride]));
+            }
+            return valid;
+        } else {
+            return size;
+        }
+    }
+
+    /*
+     null aware overloads, valid is the validity bitmap of the run (bit i of word i / 64 for value i, see Mask) or nullptr when
+     every value is valid. null values are left out, a run without a bitmap goes straight to the overloads above. the set bits are
+     gathered into maximal runs of valid values that go to the same kernels in one piece, so a word without nulls costs two bit
+     scans and values are never tested one by one. the policy overloads reduce a run with nulls on the calling thread.
+    */
+    namespace detail {
+        inline std::size_t valid_count(const std::uint64_t* valid, std::size_t size) {
+            std::size_t count = 0;
+            for (std::size_t word_idx = 0; word_idx * 64 < size; word_idx++) {
+                count += static_cast<std::size_t>(std::popcount(valid[word_idx]));
+            }
+            return count;
+        }
+
+        // run(first, count) for every maximal run of set bits in [0, size), in ascending order. bits past size must be zero.
+        template<typename Run>
+        void for_each_valid_run(const std::uint64_t* valid, std::size_t size, Run&& run) {
+            std::size_t run_begin = 0;
+            std::size_t run_end   = 0;
+            for (std::size_t word_idx = 0; word_idx * 64 < size; word_idx++) {
+                std::uint64_t word = valid[word_idx];
+                while (word != 0) {
+                    int         first  = std::countr_zero(word);
+                    int         length = std::countr_one(word >> first);
+                    std::size_t begin  = (word_idx * 64) + static_cast<std::size_t>(first);
+                    if (begin != run_end) {
+                        if (run_end > run_begin) { run(run_begin, run_end - run_begin); }
+                        run_begin = begin;
+                    }
+                    run_end = begin + static_cast<std::size_t>(length);
+                    word    = first + length == 64 ? 0 : word & (~std::uint64_t{0} << (first + length));
+                }
+            }
+            if (run_end > run_begin) { run(run_begin, run_end - run_begin); }
+        }
+
+        template<simd::Fold F, typename Acc, typename T>
+        Acc valid_sum(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid, Acc center, Summation mode) {
+            std::vector<Acc> partials;
+            for_each_valid_run(valid, size, [&](std::size_t first, std::size_t count) {
+                partials.push_back(sum<F>(data + (first * stride), count, stride, center, mode));
+            });
+            return combine_blocks(partials.data(), partials.size(), mode);
+        }
+    } // namespace detail
+
+    template<typename T>
+    sum_t<T> sum(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid, Summation mode = Summation::Pairwise) {
+        if (valid == nullptr) { return sum(data, size, stride, mode); }
+        return detail::valid_sum<simd::Fold::Sum>(data, size, stride, valid, sum_t<T>{}, mode);
+    }
+
+    template<typename T>
+    double mean(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid, Summation mode = Summation::Pairwise) {
+        if (valid == nullptr) { return mean(data, size, stride, mode); }
+        return static_cast<double>(sum(data, size, stride, valid, mode)) / static_cast<double>(detail::valid_count(valid, size));
+    }
+
+    template<typename T>
+    double var(const T*             data,
+               std::size_t          size,
+               std::size_t          stride,
+               const std::uint64_t* valid,
+               std::size_t          ddof = 1,
+               Summation            mode = Summation::Pairwise) {
+        if (valid == nullptr) { return var(data, size, stride, ddof, mode); }
+        std::size_t count = detail::valid_count(valid, size);
+        if (count <= ddof) { return std::numeric_limits<double>::quiet_NaN(); }
+        using acc_type = detail::variance_acc_t<T>;
+        auto center    = static_cast<acc_type>(mean(data, size, stride, valid, mode));
+        auto deviation = detail::valid_sum<simd::Fold::SquaredDeviation>(data, size, stride, valid, center, mode);
+        return static_cast<double>(deviation) / static_cast<double>(count - ddof);
+    }
+
+    template<typename T>
+    double stddev(const T*             data,
+                  std::size_t          size,
+                  std::size_t          stride,
+                  const std::uint64_t* valid,
+                  std::size_t          ddof = 1,
+                  Summation            mode = Summation::Pairwise) {
+        return std::sqrt(var(data, size, stride, valid, ddof, mode));
+    }
+
+    template<typename T>
+    sum_t<T> prod(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        if (valid == nullptr) { return prod(data, size, stride); }
+        sum_t<T> product = 1;
+        detail::for_each_valid_run(valid, size, [&](std::size_t first, std::size_t count) {
+            product *= prod(data + (first * stride), count, stride);
+        });
+        return product;
+    }
+
+    template<bool Max, typename T>
+    std::size_t arg_extremum(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        if (valid == nullptr) { return arg_extremum<Max>(data, size, stride); }
+        std::size_t best = size;
+        detail::for_each_valid_run(valid, size, [&](std::size_t first, std::size_t count) {
+            std::size_t pos = first + arg_extremum<Max>(data + (first * stride), count, stride);
+            if (best == size || simd::detail::improves<Max>(data[pos * stride], data[best * stride])) { best = pos; }
+        });
+        FORCED_ASSERT(best != size, "argmin/argmax of a range without valid values");
+        return best;
+    }
+
+    template<typename T>
+    std::size_t argmin(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        return arg_extremum<false>(data, size, stride, valid);
+    }
+
+    template<typename T>
+    std::size_t argmax(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        return arg_extremum<true>(data, size, stride, valid);
+    }
+
+    template<bool Max, typename T>
+    T extremum(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        if (valid == nullptr) { return extremum<Max>(data, size, stride); }
+        return data[arg_extremum<Max>(data, size, stride, valid) * stride];
+    }
+
+    // number of valid values that are not NaN.
+    template<typename T>
+    std::size_t count(const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        if (valid == nullptr) { return count(data, size, stride); }
+        std::size_t total = 0;
+        detail::for_each_valid_run(valid, size, [&](std::size_t first, std::size_t count) {
+            total += df::count(data + (first * stride), count, stride);
+        });
+        return total;
+    }
+
+    template<execution_policy Policy, typename T>
+    sum_t<T> sum(Policy               policy,
+                 const T*             data,
+                 std::size_t          size,
+                 std::size_t          stride,
+                 const std::uint64_t* valid,
+                 Summation            mode = Summation::Pairwise) {
+        return valid == nullptr ? sum(policy, data, size, stride, mode) : sum(data, size, stride, valid, mode);
+    }
+
+    template<execution_policy Policy, typename T>
+    double mean(Policy               policy,
+                const T*             data,
+                std::size_t          size,
+                std::size_t          stride,
+                const std::uint64_t* valid,
+                Summation            mode = Summation::Pairwise) {
+        return valid == nullptr ? mean(policy, data, size, stride, mode) : mean(data, size, stride, valid, mode);
+    }
+
+    template<execution_policy Policy, typename T>
+    double var(Policy               policy,
+               const T*             data,
+               std::size_t          size,
+               std::size_t          stride,
+               const std::uint64_t* valid,
+               std::size_t          ddof = 1,
+               Summation            mode = Summation::Pairwise) {
+        return valid == nullptr ? var(policy, data, size, stride, ddof, mode) : var(data, size, stride, valid, ddof, mode);
+    }
+
+    template<execution_policy Policy, typename T>
+    double stddev(Policy               policy,
+                  const T*             data,
+                  std::size_t          size,
+                  std::size_t          stride,
+                  const std::uint64_t* valid,
+                  std::size_t          ddof = 1,
+                  Summation            mode = Summation::Pairwise) {
+        return std::sqrt(var(policy, data, size, stride, valid, ddof, mode));
+    }
+
+    template<bool Max, execution_policy Policy, typename T>
+    T extremum(Policy policy, const T* data, std::size_t size, std::size_t stride, const std::uint64_t* valid) {
+        return valid == nullptr ? extremum<Max>(policy, data, size, stride) : extremum<Max>(data, size, stride, valid);
+    }
+
+    // count, sum, min and max per column over a block of rows, an entry per column so that a row major sweep walks the entries
+    // in the same order as the row. the stats of disjoint blocks merge into the stats of their union, the per thread partials
+    // of describe(). NaN values are skipped.
+    struct ColumnStats {
+        explicit ColumnStats(std::size_t col_count)
+            : counts(col_count, 0),
+              sums(col_count, 0.0),
+              mins(col_count, std::numeric_limits<double>::infinity()),
+              maxs(col_count, -std::numeric_limits<double>::infinity()) {
+        }
+
+        void push(std::size_t col_idx, double value) {
+            bool valid = !std::isnan(value);
+            counts[col_idx] += static_cast<std::size_t>(valid);
+            sums[col_idx] += valid ? value : 0.0;
+            mins[col_idx] = value < mins[col_idx] ? value : mins[col_idx];
+            maxs[col_idx] = value > maxs[col_idx] ? value : maxs[col_idx];
+        }
+
+        void merge(const ColumnStats& other) {
+            for (std::size_t col_idx = 0; col_idx < counts.size(); col_idx++) {
+                counts[col_idx] += other.counts[col_idx];
+                sums[col_idx] += other.sums[col_idx];
+                mins[col_idx] = std::min(mins[col_idx], other.mins[col_idx]);
+                maxs[col_idx] = std::max(maxs[col_idx], other.maxs[col_idx]);
+            }
+        }
+
+        std::vector<std::size_t> counts;
+        std::vector<double>      sums;
+        std::vector<double>      mins;
+        std::vector<double>      maxs;
+    };
+
+    // quantiles qs (ascending, in [0, 1]) of values written to out, linear interpolation between the closest ranks.
+    // values is reordered, each quantile selects within the part left of it by the previous one. NaN for an empty run.
+    inline void quantiles(double* values, std::size_t size, const double* qs, std::size_t q_count, double* out) {
+        std::size_t first = 0;
+        for (std::size_t i = 0; i < q_count; i++) {
+            if (size == 0) {
+                out[i] = std::numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+            double      pos = qs[i] * static_cast<double>(size - 1);
+            std::size_t lo  = std::min(static_cast<std::size_t>(pos), size - 1);
+            std::nth_element(values + first, values + lo, values + size);
+            double lo_value = values[lo];
+            double hi_value = lo + 1 < size ? *std::min_element(values + lo + 1, values + size) : lo_value;
+            out[i]          = lo_value + ((pos - static_cast<double>(lo)) * (hi_value - lo_value));
+            first           = lo;
+        }
+    }
+
+} // namespace df
+
+#endif // DATA_FRAME_REDUCE_H
@@ -4,7 +4,9 @@
 #include "df_base_iterator.hpp"
 #include "df_common.hpp"
 #include "df_logger.hpp"
+#include "df_mask.hpp"
 #include "df_row_view.hpp"
+#include "df_sort.hpp"
 
 namespace df {
 
@@ -16,19 +18,73 @@ namespace df {
         template<typename>
         friend class DataFrame;
 
+        template<typename>
+        friend class ColumnView;
+
       public:
-        using value_type     = T;
-        using data_type      = typename value_type::data_type;
-        using iterator       = BaseIterator<RowGroupView, false>;
-        using const_iterator = BaseIterator<RowGroupView, true>;
+        using value_type = T;
+        using data_type  = typename value_type::data_type;
+
+        // yields row views by value, rows are materialized from the frame on dereference.
+        class RowGroupIterator {
+          public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = T;
+
+            RowGroupIterator() : m_rg(nullptr), m_pos(0) {
+            }
+
+            RowGroupIterator(const RowGroupView* rg, std::size_t pos) : m_rg(rg), m_pos(pos) {
+            }
+
+            // clang-format off
+            reference operator*() const { return m_rg->at(m_pos); }
+            reference operator[](difference_type n) const { return m_rg->at(m_pos + n); }
+
+            RowGroupIterator& operator++() { ++m_pos; return *this; }
+            RowGroupIterator operator++(int) { RowGroupIterator tmp = *this; ++m_pos; return tmp; }
+            RowGroupIterator& operator--() { --m_pos; return *this; }
+            RowGroupIterator operator--(int) { RowGroupIterator tmp = *this; --m_pos; return tmp; }
+
+            RowGroupIterator operator+(difference_type n) const { return RowGroupIterator(m_rg, m_pos + n); }
+            RowGroupIterator operator-(difference_type n) const { return RowGroupIterator(m_rg, m_pos - n); }
+            difference_type operator-(const RowGroupIterator& other) const { return static_cast<difference_type>(m_pos) - static_cast<difference_type>(other.m_pos); }
+
+            bool operator==(const RowGroupIterator& other) const { return m_pos == other.m_pos; }
+            auto operator<=>(const RowGroupIterator& other) const { return m_pos <=> other.m_pos; }
+            // clang-format on
+
+          private:
+            const RowGroupView* m_rg;
+            std::size_t         m_pos;
+        };
+
+        using iterator       = RowGroupIterator;
+        using const_iterator = RowGroupIterator;
 
       private:
-        RowGroupView(DataFrame<data_type>* df) : logger(this), logging_context(df->logger.context) {
+        using dataframe_pointer
+        = std::conditional_t<std::is_same_v<value_type, RowView<const data_type>>, const DataFrame<data_type>*, DataFrame<data_type>*>;
+
+        // the group only keeps the indices of its rows, row views are created on access.
+        RowGroupView(dataframe_pointer df) : logger(this), logging_context(df->logger.context), m_df(df), m_rows(df->row_count()) {
             m_size     = df->row_count();
-            m_d        = new value_type[m_size];
             m_row_size = df->row_size();
-            for (auto row_iter = df->iter_rows(); row_iter < df->end(); row_iter++) {
-                m_d[row_iter.current_row_idx()] = row_iter.current_row();
+            std::iota(m_rows.begin(), m_rows.end(), std::size_t{0});
+            logger.with_context(logging_context);
+        }
+
+        RowGroupView(dataframe_pointer df, std::vector<std::size_t> rows)
+            : logger(this),
+              logging_context(df->logger.context),
+              m_df(df),
+              m_size(rows.size()),
+              m_rows(std::move(rows)),
+              m_row_size(df->row_size()) {
+            for (std::size_t row_idx : m_rows) {
+                if (row_idx >= df->row_count()) { throw std::out_of_range("row index out of range"); }
             }
             logger.with_context(logging_context);
         }
@@ -37,27 +93,22 @@ namespace df {
         RowGroupView(const RowGroupView& other)
             : logger(this),
               logging_context(other.logging_context),
+              m_df(other.m_df),
               m_size(other.m_size),
-              m_d(new value_type[m_size]),
+              m_rows(other.m_rows),
               m_row_size(other.m_row_size) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i] = other.m_d[i];
-            }
             logger.with_context(logging_context);
         }
 
         RowGroupView(RowGroupView&& other)
             : logger(this),
               logging_context(other.logging_context),
+              m_df(other.m_df),
               m_size(other.m_size),
-              m_d(other.m_d),
+              m_rows(std::move(other.m_rows)),
               m_row_size(other.m_row_size) {
             logger.with_context(logging_context);
-            other.m_d = nullptr;
-        }
-
-        ~RowGroupView() {
-            delete[] m_d;
+            other.m_size = 0;
         }
 
         RowGroupView operator=(const RowGroupView& other) = delete; // why?
@@ -65,35 +116,113 @@ namespace df {
         RowGroupView& operator=(RowGroupView&& other) {
             if (this != &other) {
                 logging_context = other.logging_context;
+                m_df            = other.m_df;
                 m_size          = other.m_size;
-                m_d             = other.m_d;
+                m_rows          = std::move(other.m_rows);
                 m_row_size      = other.m_row_size;
-                other.m_d       = nullptr;
+                other.m_size    = 0;
             }
             return *this;
         }
 
-        value_type& operator[](const std::size_t& idx) {
-            return m_d[idx];
+        value_type operator[](const std::size_t& idx) const {
+            return m_df->row(m_rows[idx]);
         }
 
-        const value_type& operator[](const std::size_t& idx) const {
-            return m_d[idx];
+        // stable, only the row indices move. see sort_rows_by(). rows with a null key go first or last, see sort_rows_with_nulls().
+        RowGroupView& sort(std::string_view column_name, const bool ascending = false, NullOrder nulls = NullOrder::Last)
+            requires(std::totally_ordered<data_type>)
+        {
+            return sort(execution::seq, column_name, ascending, nulls);
+        }
+
+        // same order as sort(column_name, ascending), execution::par sorts with several threads.
+        template<execution_policy Policy>
+        RowGroupView& sort(Policy policy, std::string_view column_name, const bool ascending = false, NullOrder nulls = NullOrder::Last)
+            requires(std::totally_ordered<data_type>)
+        {
+            const DataFrame<data_type>& df  = *m_df;
+            auto                        key = df.column(column_name);
+            sort_rows_with_nulls(key, m_rows, nulls, [&](std::vector<std::size_t>& rows) { sort_rows_by(policy, key, rows, ascending); });
+            return *this;
         }
 
-        template<typename U = data_type, typename = std::enable_if_t<std::is_arithmetic_v<data_type>, bool>>
-        RowGroupView& sort(const std::string& column_name, const bool ascending = false) {
-            std::size_t col_idx = m_d[0].column_index_of(column_name);
+        // stable multi column sort in a single pass, e.g. sort({{"col-a", asc}, {"col-b", desc}}).
+        RowGroupView& sort(const std::vector<SortKey>& keys)
+            requires(std::totally_ordered<data_type>)
+        {
+            return sort(execution::seq, keys);
+        }
 
-            std::sort(m_d, m_d + m_size, [ascending, col_idx](value_type& a, value_type& b) {
-                const data_type& a_val = a[col_idx]->value;
-                const data_type& b_val = b[col_idx]->value;
-                return ascending ? (a_val < b_val) : (a_val > b_val);
-            });
+        template<execution_policy Policy>
+        RowGroupView& sort(Policy policy, const std::vector<SortKey>& keys)
+            requires(std::totally_ordered<data_type>)
+        {
+            const DataFrame<data_type>& df = *m_df;
+            if (keys.size() == 1) { return sort(policy, keys[0].column_name, keys[0].order == SortOrder::Ascending, keys[0].nulls); }
 
+            MultiKeyLess<typename DataFrame<data_type>::const_column_type> less;
+            for (const SortKey& key : keys) {
+                less.add(df.column(key.column_name), key.order, key.nulls);
+            }
+            sort_rows_by(policy, less, m_rows);
             return *this;
         }
 
+        // the k rows of the group with the largest values in column_name, largest first. the group itself is not changed.
+        RowGroupView nlargest(std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return nlargest(execution::seq, column_name, k);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView nlargest(Policy policy, std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return top_k(policy, column_name, k, true);
+        }
+
+        // the k rows of the group with the smallest values in column_name, smallest first.
+        RowGroupView nsmallest(std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return nsmallest(execution::seq, column_name, k);
+        }
+
+        template<execution_policy Policy>
+        RowGroupView nsmallest(Policy policy, std::string_view column_name, std::size_t k) const
+            requires(std::totally_ordered<data_type>)
+        {
+            return top_k(policy, column_name, k, false);
+        }
+
+        // the rows of the group whose bit is set, mask position i is the i-th row of the group. the group itself is not changed.
+        RowGroupView filter(const Mask& mask) const {
+            FORCED_ASSERT(mask.size() == m_size, "filter with a mask of nonmatching size");
+            std::vector<std::size_t> rows = mask.indices();
+            for (std::size_t& row : rows) {
+                row = m_rows[row];
+            }
+            return RowGroupView(m_df, std::move(rows));
+        }
+
+        // the rows of the group for which predicate(row) is true, in group order.
+        template<typename Predicate>
+            requires(std::predicate<Predicate&, value_type>)
+        RowGroupView filter(Predicate predicate) const {
+            std::vector<std::size_t> rows;
+            for (std::size_t row_idx : m_rows) {
+                if (predicate(m_df->row(row_idx))) { rows.push_back(row_idx); }
+            }
+            return RowGroupView(m_df, std::move(rows));
+        }
+
+        // gathers the rows of the group into a new frame.
+        DataFrame<data_type> to_dataframe(Layout layout = Layout::RowMajor) const {
+            return DataFrame<data_type>(*this, layout);
+        }
+
         std::size_t size() const {
             return m_size;
         }
@@ -102,32 +231,51 @@ namespace df {
             return m_row_size;
         }
 
-        value_type& at(std::size_t index) {
-            return m_d[index];
+        const DataFrame<data_type>* dataframe() const {
+            return m_df;
         }
 
-        const value_type& at(std::size_t index) const {
-            return m_d[index];
+        // frame row index of the idx-th row in the group.
+        std::size_t row_index(std::size_t idx) const {
+            return m_rows[idx];
+        }
+
+        const std::vector<std::size_t>& row_indices() const {
+            return m_rows;
+        }
+
+        value_type at(std::size_t index) const {
+            return m_df->row(m_rows.at(index));
         }
 
         iterator begin() const {
-            return iterator(m_d);
+            return iterator(this, 0);
         }
 
         iterator end() const {
-            return iterator(m_d + m_size);
+            return iterator(this, m_size);
         }
 
         void log(int range = 0) const {
             logger.log(range);
         }
 
-        RowGroup_Logger<data_type> logger;
+        RowGroup_Logger<data_type, value_type> logger;
 
       private:
+        template<execution_policy Policy>
+        RowGroupView top_k(Policy policy, std::string_view column_name, std::size_t k, bool largest) const {
+            const DataFrame<data_type>& df   = *m_df;
+            std::vector<std::size_t>    rows = m_rows;
+            drop_null_rows(df.column(column_name), rows);
+            select_top_k(policy, df.column(column_name), rows, k, largest);
+            return RowGroupView(m_df, std::move(rows));
+        }
+
         LoggingContext<data_type> logging_context;
+        dataframe_pointer         m_df;
         std::size_t               m_size;
-        value_type*               m_d;
+        std::vector<std::size_t>  m_rows;
         std::size_t               m_row_size;
     };
 
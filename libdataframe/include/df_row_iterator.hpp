@@ -10,30 +10,31 @@ namespace df {
     class RowIterator {
 
       public:
-        using dataframe_iterator = std::conditional_t<IsConst, typename dataframe::const_iterator, typename dataframe::iterator>;
-        using row                = std::conditional_t<IsConst, typename dataframe::const_row_type, typename dataframe::row_type>;
+        using dataframe_pointer = std::conditional_t<IsConst, const dataframe*, dataframe*>;
+        using row               = std::conditional_t<IsConst, typename dataframe::const_row_type, typename dataframe::row_type>;
 
-        RowIterator(const dataframe_iterator df_begin, std::size_t row_size) : m_ptr(df_begin), m_row_size(row_size), m_current_row_idx(0) {
+        RowIterator(dataframe_pointer df) : m_df(df), m_current_row_idx(0) {
         }
 
         ~RowIterator() {
         }
 
-        RowIterator(const RowIterator<dataframe, true>& other)
+        RowIterator(const RowIterator<dataframe, false>& other)
             requires(IsConst)
-            : m_ptr(other.m_ptr) {
+            : m_df(other.m_df),
+              m_current_row_idx(other.m_current_row_idx) {
         }
 
-        RowIterator(const RowIterator& other) : m_ptr(other.m_ptr), m_row_size(other.m_row_size), m_current_row_idx(other.m_current_row_idx) {
+        RowIterator(const RowIterator& other) : m_df(other.m_df), m_current_row_idx(other.m_current_row_idx) {
         }
 
         // Implicit conversion to row; use for syntactic convenience (e.g., auto r = *it).
         operator row() {
-            return row(m_ptr, m_current_row_idx, m_row_size);
+            return current_row();
         }
 
         row current_row() {
-            return row(m_ptr, m_current_row_idx, m_row_size);
+            return m_df->row(m_current_row_idx);
         }
 
         std::size_t current_row_idx() const {
@@ -42,8 +43,7 @@ namespace df {
 
         RowIterator& operator=(const RowIterator& other) {
             if (this != &other) {
-                m_ptr             = other.m_ptr;
-                m_row_size        = other.m_row_size;
+                m_df              = other.m_df;
                 m_current_row_idx = other.m_current_row_idx;
             }
             return *this;
@@ -51,7 +51,7 @@ namespace df {
 
         RowIterator operator+(const std::size_t& off) const {
             RowIterator tmp{*this};
-            if (tmp += off; tmp.m_current_row_idx >= tmp.m_row_size) { throw std::out_of_range("ColumnIterator::operator+ out of range"); }
+            if (tmp += off; tmp.m_current_row_idx >= tmp.m_df->row_count()) { throw std::out_of_range("RowIterator::operator+ out of range"); }
             return tmp;
         }
 
@@ -87,30 +87,38 @@ namespace df {
             return *this;
         }
 
+        // every row holds row_size() cells whatever the layout is, so the n-th row is
+        // in range as long as n * row_size() is still inside the frame buffer.
         template<bool B>
         friend bool operator<(const RowIterator& lhs, const BaseIterator<dataframe, B>& rhs) {
-            return (lhs.m_ptr + (lhs.m_current_row_idx * lhs.m_row_size)) < rhs;
+            return lhs.position() < rhs;
         }
 
         template<bool B>
         friend bool operator<(const BaseIterator<dataframe, B>& lhs, const RowIterator& rhs) {
-            return lhs < (rhs.m_ptr + (rhs.m_current_row_idx * rhs.m_row_size));
+            return lhs < rhs.position();
         }
 
         template<bool B>
         friend bool operator>(const RowIterator& lhs, const BaseIterator<dataframe, B>& rhs) {
-            return (lhs.m_ptr + (lhs.m_current_row_idx * lhs.m_row_size)) > rhs;
+            return lhs.position() > rhs;
         }
 
         template<bool B>
         friend bool operator>(const BaseIterator<dataframe, B>& lhs, const RowIterator& rhs) {
-            return lhs > (rhs.m_ptr + (rhs.m_current_row_idx * rhs.m_row_size));
+            return lhs > rhs.position();
         }
 
       private:
-        dataframe_iterator m_ptr;
-        std::size_t        m_row_size;
-        std::size_t        m_current_row_idx;
+        template<typename, bool>
+        friend class RowIterator;
+
+        auto position() const {
+            return m_df->begin() + (m_current_row_idx * m_df->row_size());
+        }
+
+        dataframe_pointer m_df;
+        std::size_t       m_current_row_idx;
     };
 } // namespace df
 
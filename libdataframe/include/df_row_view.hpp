@@ -12,7 +12,7 @@ namespace df {
     template<typename T>
     class DataFrame;
 
-    template<typename CellType>
+    template<typename ValueType>
     class RowView {
 
         template<typename>
@@ -25,116 +25,69 @@ namespace df {
         friend class RowIterator;
 
       public:
-        using data_type        = typename CellType::data_type;
-        using value_type       = CellType*;
-        using const_value_type = const CellType*;
+        using data_type  = std::remove_const_t<ValueType>;
+        using value_type = data_type;
+        using reference  = ValueType&;
+        using pointer    = ValueType*;
         using dataframe_iterator
-        = std::conditional_t<std::is_const_v<CellType>, typename DataFrame<data_type>::const_iterator, typename DataFrame<data_type>::iterator>;
-        using iterator = BaseIterator<RowView<CellType>, std::is_const_v<CellType>>;
+        = std::conditional_t<std::is_const_v<ValueType>, typename DataFrame<data_type>::const_iterator, typename DataFrame<data_type>::iterator>;
+        using iterator = StridedIterator<RowView<ValueType>, std::is_const_v<ValueType>>;
 
       private:
-        RowView(dataframe_iterator df_begin, std::size_t row_idx, std::size_t row_size) {
-            m_size = row_size;
-            m_d    = new value_type[m_size];
-
-            dataframe_iterator row_begin = df_begin + (row_idx * row_size);
-            for (std::size_t idx = 0; idx < row_size; idx++) {
-                m_d[idx] = &(row_begin + idx);
-            }
+        // non-owning view: the first cell of the row, the number of cells and the distance between two of them.
+        // in a row major frame the stride is 1 and the view is a plain span over the buffer.
+        RowView(dataframe_iterator row_begin, std::size_t row_size, std::size_t stride, std::size_t row_idx, const DataFrame<data_type>* df)
+            : m_df(df),
+              m_idx(row_idx),
+              m_size(row_size),
+              m_stride(stride),
+              m_d(&row_begin) {
         }
 
       public:
-        RowView() : m_size(0), m_d(nullptr) {
+        RowView() : m_df(nullptr), m_idx(0), m_size(0), m_stride(0), m_d(nullptr) {
         }
 
-        RowView(const RowView& other) : m_size(other.m_size), m_d(new value_type[other.m_size]) {
-            std::copy(other.begin(), other.end(), m_d);
-        }
+        RowView(const RowView& other) = default;
 
-        RowView(RowView&& other) : m_size(other.m_size), m_d(other.m_d) {
-            other.m_d    = nullptr;
-            other.m_size = 0;
-        }
+        // rebinds the view, use operator=(const Series&) to copy values into the row.
+        RowView& operator=(const RowView& rhs) = default;
 
-        ~RowView() {
-            delete[] m_d;
+        reference operator[](const std::size_t& idx) const {
+            return m_d[idx * m_stride];
         }
 
-        value_type& operator[](const std::size_t& idx) {
-            return m_d[idx];
-        }
-
-        value_type& operator[](const std::string& col_name) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.col_name == col_name) { return m_d[i]; }
-            }
-
-            std::cerr << "col name not found.";
-            abort();
-        }
-
-        RowView& operator=(const RowView& rhs) {
-            if (this != &rhs) {
-                if (is_null()) {
-                    FORCED_ASSERT(m_d == nullptr, "m_d supposed to be null pointer, something is wrong");
-                    m_size = rhs.m_size;
-                    m_d    = new value_type[m_size];
-                } else {
-                    FORCED_ASSERT(m_size == rhs.m_size, "assignment operation on nonmatching size objects");
-                }
-                for (std::size_t i = 0; i < m_size; i++) {
-                    m_d[i] = rhs.m_d[i];
-                }
-            }
-            return *this;
+        reference operator[](std::string_view col_name) const {
+            return (*this)[m_df->get_col_idx(col_name)];
         }
 
-        RowView& operator=(RowView&& rhs) {
-            if (this != &rhs) {
-                m_size  = rhs.m_size;
-                m_d     = rhs.m_d;
-                rhs.m_d = nullptr;
-            }
-            return *this;
-        }
-
-        RowView& operator=(const Series<CellType>& rhs) const {
+        RowView& operator=(const Series<data_type>& rhs) {
             FORCED_ASSERT(m_d != nullptr, "m_d is not supposed to be null pointer, something is wrong");
             FORCED_ASSERT(m_size == rhs.size(), "assignment operation on nonmatching size objects");
             for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i]->value = rhs[i];
+                m_d[i * m_stride] = rhs[i];
             }
             return *this;
         }
 
-        Series<data_type> to_series() {
+        Series<data_type> to_series() const {
             Series<data_type> data(m_size);
             for (std::size_t i = 0; i < m_size; i++) {
-                data[i] = m_d[i]->value;
+                data[i] = m_d[i * m_stride];
             }
             return data;
         }
 
-        value_type& at_column(const std::string& col_name) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.col_name == col_name) { return m_d[i]; }
-            }
-
-            std::cerr << "col name not found.";
-            abort();
+        reference at_column(std::string_view col_name) const {
+            return (*this)[column_index_of(col_name)];
         }
 
-        std::size_t column_index_of(const std::string& column_name) const {
-            for (std::size_t i = 0; i < m_size; i++) {
-                if (m_d[i]->idx.col_name == column_name) { return i; }
-            }
-
-            std::cerr << "col name not found.";
-            abort();
+        std::size_t column_index_of(std::string_view column_name) const {
+            return m_df->get_col_idx(column_name);
         }
 
         friend std::ostream& operator<<(std::ostream& os, const RowView& row) {
-            os << "Row(addr: " << &row << ", size: " << row.m_size << ", type: " << typeid(CellType).name() << ")";
+            os << "Row(addr: " << &row << ", size: " << row.m_size << ", type: " << typeid(ValueType).name() << ")";
             return os;
         }
 
@@ -143,19 +96,31 @@ namespace df {
         }
 
         std::size_t index() const {
-            return m_d[0]->idx.row_idx;
+            return m_idx;
+        }
+
+        const std::string& name() const {
+            return m_df->get_row_name(m_idx);
+        }
+
+        std::size_t stride() const {
+            return m_stride;
+        }
+
+        bool is_contiguous() const {
+            return m_stride == 1;
         }
 
-        std::string name() const {
-            return m_d[0]->idx.row_name;
+        pointer data() const {
+            return m_d;
         }
 
         iterator begin() const {
-            return iterator(m_d);
+            return iterator(m_d, static_cast<std::ptrdiff_t>(m_stride));
         }
 
         iterator end() const {
-            return iterator(m_d + m_size);
+            return iterator(m_d + (m_size * m_stride), static_cast<std::ptrdiff_t>(m_stride));
         }
 
         bool is_null() const {
@@ -163,8 +128,11 @@ namespace df {
         }
 
       private:
-        std::size_t m_size;
-        value_type* m_d;
+        const DataFrame<data_type>* m_df;
+        std::size_t                 m_idx;
+        std::size_t                 m_size;
+        std::size_t                 m_stride;
+        pointer                     m_d;
     };
 
 } // namespace df
@@ -3,8 +3,15 @@
 
 #include "df_base_iterator.hpp"
 #include "df_common.hpp"
+#include "df_expr.hpp"
+#include "df_mask.hpp"
+#include "df_reduce.hpp"
 
 namespace df {
+    template<typename... Ts>
+        requires(sizeof...(Ts) > 0)
+    class TypedDataFrame;
+
     template<typename T>
     class Series {
 
@@ -21,336 +28,281 @@ namespace df {
             std::copy(il.begin(), il.end(), m_d);
         }
 
+        // evaluates an expression in a single loop into a new buffer.
+        template<expression E>
+            requires(!std::is_same_v<std::remove_cvref_t<E>, Series>)
+        Series(const E& expr) : m_d(new data_type[expr.size()]), m_size(expr.size()), m_validity(combined_validity(expr)) {
+            evaluate_into(m_d, expr);
+        }
+
         ~Series() {
             delete[] m_d;
         }
 
-        Series(const Series& other) {
+        Series(const Series& other) : m_validity(other.m_validity) {
             m_size = other.m_size;
             m_d    = new T[m_size];
             std::copy(other.begin(), other.end(), m_d);
         }
 
+        Series(Series&& other) noexcept : m_d(other.m_d), m_size(other.m_size), m_validity(std::move(other.m_validity)) {
+            other.m_d    = nullptr;
+            other.m_size = 0;
+            other.m_validity.reset();
+        }
+
         Series& operator=(const Series& other) {
             FORCED_ASSERT(m_size == other.m_size, "copy assignment operator on nonmatching size objects");
             if (this != &other) {
                 for (std::size_t i = 0; i < m_size; i++) {
                     m_d[i] = other[i];
                 }
+                m_validity = other.m_validity;
             }
             return *this;
         }
 
-        data_type& operator[](std::size_t idx) {
-            return *(m_d + idx);
-        }
-
-        const data_type& operator[](std::size_t idx) const {
-            return *(m_d + idx);
-        }
-
-        // comparaison operators
-        Series<bool> operator==(const Series& other) const {
-            FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i] == other[i]);
-            }
-            return temp;
-        }
-
-        friend Series<bool> operator==(const Series& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i] == rhs);
+        // takes over the buffer of other, the sizes do not have to match unless the series is a column of a frame.
+        Series& operator=(Series&& other) noexcept {
+            FORCED_ASSERT(!m_fixed_size || m_size == other.m_size, "size changing assignment to a frame column");
+            if (this != &other) {
+                delete[] m_d;
+                m_d          = other.m_d;
+                m_size       = other.m_size;
+                m_validity   = std::move(other.m_validity);
+                other.m_d    = nullptr;
+                other.m_size = 0;
+                other.m_validity.reset();
             }
-            return temp;
-        }
-
-        friend Series<bool> operator==(const data_type& lhs, const Series& rhs) {
-            return rhs == lhs;
+            return *this;
         }
 
-        Series<bool> operator!=(const Series& other) const {
-            FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i] != other[i]);
-            }
-            return temp;
+        // evaluates an expression straight into the existing buffer, the expression may refer to this series.
+        // like move assignment, a result of another size replaces the buffer.
+        template<expression E>
+            requires(!std::is_same_v<std::remove_cvref_t<E>, Series>)
+        Series& operator=(const E& expr) {
+            if (m_size != expr.size()) { return *this = Series(expr); }
+            std::optional<Mask> valid = combined_validity(expr);
+            evaluate_into(m_d, expr);
+            m_validity = std::move(valid);
+            return *this;
         }
 
-        friend Series<bool> operator!=(const Series& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i] != rhs);
-            }
-            return temp;
+        data_type& operator[](std::size_t idx) {
+            return *(m_d + idx);
         }
 
-        friend Series<bool> operator!=(const data_type& lhs, const Series& rhs) {
-            return rhs != lhs;
+        const data_type& operator[](std::size_t idx) const {
+            return *(m_d + idx);
         }
 
-        Series<bool> operator>=(const Series& other) const {
-            FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i] >= other[i]);
-            }
-            return temp;
+        // binary arithmetic and comparison operators build expressions, see df_expr.hpp.
+        // the compound assignments update the buffer in place, rhs is a value or an expression of the same size.
+        // a value that is null in rhs becomes null.
+        template<typename Rhs>
+            requires(expression<Rhs> || std::convertible_to<Rhs, data_type>)
+        Series& operator+=(const Rhs& rhs) {
+            apply_in_place<std::plus<>>(m_d, m_size, 1, rhs);
+            merge_validity(rhs);
+            return *this;
         }
 
-        friend Series<bool> operator>=(const Series& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i] >= rhs);
-            }
-            return temp;
+        template<typename Rhs>
+            requires(expression<Rhs> || std::convertible_to<Rhs, data_type>)
+        Series& operator-=(const Rhs& rhs) {
+            apply_in_place<std::minus<>>(m_d, m_size, 1, rhs);
+            merge_validity(rhs);
+            return *this;
         }
 
-        friend Series<bool> operator>=(const data_type& lhs, const Series& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs >= rhs[i]);
-            }
-            return temp;
+        template<typename Rhs>
+            requires(expression<Rhs> || std::convertible_to<Rhs, data_type>)
+        Series& operator*=(const Rhs& rhs) {
+            apply_in_place<std::multiplies<>>(m_d, m_size, 1, rhs);
+            merge_validity(rhs);
+            return *this;
         }
 
-        Series<bool> operator<=(const Series& other) const {
-            FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i] <= other[i]);
-            }
-            return temp;
+        template<typename Rhs>
+            requires(expression<Rhs> || std::convertible_to<Rhs, data_type>)
+        Series& operator/=(const Rhs& rhs) {
+            apply_in_place<std::divides<>>(m_d, m_size, 1, rhs);
+            merge_validity(rhs);
+            return *this;
         }
 
-        friend Series<bool> operator<=(const Series& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i] <= rhs);
-            }
+        Series operator++(int) {
+            Series temp{*this};
+            ++(*this);
             return temp;
         }
 
-        friend Series<bool> operator<=(const data_type& lhs, const Series& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs <= rhs[i]);
-            }
-            return temp;
+        Series& operator++() {
+            return *this += data_type{1};
         }
 
-        Series<bool> operator<(const Series& other) const {
-            FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i] < other[i]);
-            }
-            return temp;
+        Series operator--(int) {
+            Series tmp{*this};
+            --(*this);
+            return tmp;
         }
 
-        friend Series<bool> operator<(const Series& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i] < rhs);
-            }
-            return temp;
+        Series& operator--() {
+            return *this -= data_type{1};
         }
 
-        friend Series<bool> operator<(const data_type& lhs, const Series& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs < rhs[i]);
-            }
-            return temp;
-        }
-
-        Series<bool> operator>(const Series& other) const {
-            FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
-            Series<bool> temp(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                temp[i] = (m_d[i] > other[i]);
-            }
-            return temp;
+        template<typename U = T, std::enable_if_t<std::is_arithmetic_v<U>, bool> = true>
+        T max() const {
+            return df::extremum<true>(m_d, m_size, 1, valid_words());
         }
 
-        friend Series<bool> operator>(const Series& lhs, const data_type& rhs) {
-            Series<bool> temp(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                temp[i] = (lhs[i] > rhs);
-            }
-            return temp;
+        template<typename U = T, std::enable_if_t<std::is_arithmetic_v<U>, bool> = true>
+        T min() const {
+            return df::extremum<false>(m_d, m_size, 1, valid_words());
         }
 
-        friend Series<bool> operator>(const data_type& lhs, const Series& rhs) {
-            Series<bool> temp(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                temp[i] = (lhs > rhs[i]);
-            }
-            return temp;
+        // validity. every value is valid until set_null() adds a bitmap, a Series without one pays nothing for null support.
+        bool is_valid(std::size_t idx) const {
+            return !m_validity || (*m_validity)[idx];
         }
 
-        // arithmetic operators
-        Series operator+(const Series& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i] + rhs[i];
-            }
-            return res;
+        // the validity bitmap, every bit set when there is none.
+        Mask is_valid() const {
+            return m_validity ? *m_validity : Mask(m_size, true);
         }
 
-        friend Series operator+(const Series& lhs, const data_type& rhs) {
-            Series res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i] + rhs;
-            }
-            return res;
+        void set_null(std::size_t idx) {
+            if (!m_validity) { m_validity.emplace(m_size, true); }
+            m_validity->set(idx, false);
         }
 
-        friend Series operator+(const data_type& lhs, const Series& rhs) {
-            return rhs + lhs;
+        void set_valid(std::size_t idx) {
+            if (m_validity) { m_validity->set(idx, true); }
         }
 
-        Series operator+=(const Series& rhs) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i] += rhs[i];
-            }
-            return *this;
+        void set_validity(Mask valid) {
+            FORCED_ASSERT(valid.size() == m_size, "validity bitmap of nonmatching size");
+            m_validity = std::move(valid);
         }
 
-        Series operator+=(const data_type& rhs) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i] += rhs;
-            }
-            return *this;
+        // marks every value valid and drops the bitmap.
+        void clear_validity() {
+            m_validity.reset();
         }
 
-        Series operator++(int) {
-            Series temp{*this};
-            ++(*this);
-            return temp;
+        // nullptr when every value is valid.
+        const Mask* validity() const {
+            return m_validity ? &*m_validity : nullptr;
         }
 
-        Series operator++() {
-            for (std::size_t i = 0; i < m_size; i++) {
-                ++m_d[i];
-            }
-            return *this;
+        bool has_nulls() const {
+            return m_validity && !m_validity->all();
         }
 
-        Series operator*(const Series& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i] * rhs[i];
-            }
-            return res;
+        std::size_t null_count() const {
+            return m_validity ? m_size - m_validity->count() : 0;
         }
 
-        friend Series operator*(const Series& lhs, const data_type& rhs) {
-            Series res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i] * rhs;
-            }
-            return res;
+        // reductions, see df_reduce.hpp. null values are left out.
+        sum_t<T> sum(Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::sum(m_d, m_size, 1, valid_words(), mode);
         }
 
-        friend Series operator*(const data_type& lhs, const Series& rhs) {
-            return rhs * lhs;
+        double mean(Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::mean(m_d, m_size, 1, valid_words(), mode);
         }
 
-        Series operator-(const Series& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i] - rhs[i];
-            }
-            return res;
+        double var(std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::var(m_d, m_size, 1, valid_words(), ddof, mode);
         }
 
-        friend Series operator-(const Series& lhs, const data_type& rhs) {
-            Series res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i] - rhs;
-            }
-            return res;
+        double std(std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::stddev(m_d, m_size, 1, valid_words(), ddof, mode);
         }
 
-        friend Series operator-(const data_type& lhs, const Series& rhs) {
-            Series res(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                res[i] = lhs - rhs[i];
-            }
-            return res;
+        // the same reductions split into fixed blocks, reproducible for any thread count, see reduction_block.
+        template<execution_policy Policy>
+        sum_t<T> sum(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::sum(policy, m_d, m_size, 1, valid_words(), mode);
         }
 
-        Series operator-=(const Series& rhs) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i] -= rhs[i];
-            }
-            return *this;
+        template<execution_policy Policy>
+        double mean(Policy policy, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::mean(policy, m_d, m_size, 1, valid_words(), mode);
         }
 
-        Series operator-=(const data_type& rhs) {
-            for (std::size_t i = 0; i < m_size; i++) {
-                m_d[i] -= rhs;
-            }
-            return *this;
+        template<execution_policy Policy>
+        double var(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::var(policy, m_d, m_size, 1, valid_words(), ddof, mode);
         }
 
-        Series operator--(int) {
-            Series tmp{*this};
-            --(*this);
-            return tmp;
+        template<execution_policy Policy>
+        double std(Policy policy, std::size_t ddof = 1, Summation mode = Summation::Pairwise) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::stddev(policy, m_d, m_size, 1, valid_words(), ddof, mode);
         }
 
-        Series operator--() {
-            for (std::size_t i = 0; i < m_size; i++) {
-                --m_d[i];
-            }
-            return *this;
+        template<execution_policy Policy>
+        T min(Policy policy) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::extremum<false>(policy, m_d, m_size, 1, valid_words());
         }
 
-        Series operator/(const Series& rhs) const {
-            FORCED_ASSERT(m_size == rhs.m_size, "arithmetic operation on nonmatching size objects");
-            Series res(m_size);
-            for (std::size_t i = 0; i < m_size; i++) {
-                res[i] = m_d[i] / rhs[i];
-            }
-            return res;
+        template<execution_policy Policy>
+        T max(Policy policy) const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::extremum<true>(policy, m_d, m_size, 1, valid_words());
         }
 
-        friend Series operator/(const Series& lhs, const data_type& rhs) {
-            Series res(lhs.m_size);
-            for (std::size_t i = 0; i < lhs.m_size; i++) {
-                res[i] = lhs[i] / rhs;
-            }
-            return res;
+        sum_t<T> prod() const
+            requires(std::is_arithmetic_v<T>)
+        {
+            return df::prod(m_d, m_size, 1, valid_words());
         }
 
-        friend Series operator/(const data_type& lhs, const Series& rhs) {
-            Series res(rhs.m_size);
-            for (std::size_t i = 0; i < rhs.m_size; i++) {
-                res[i] = lhs / rhs[i];
-            }
-            return res;
+        std::size_t argmin() const
+            requires(std::totally_ordered<T>)
+        {
+            return df::argmin(m_d, m_size, 1, valid_words());
         }
 
-        template<typename U = T, std::enable_if_t<std::is_arithmetic_v<U>, bool> = true>
-        T max() const {
-            return *std::max_element(m_d, m_d + m_size);
+        std::size_t argmax() const
+            requires(std::totally_ordered<T>)
+        {
+            return df::argmax(m_d, m_size, 1, valid_words());
         }
 
-        template<typename U = T, std::enable_if_t<std::is_arithmetic_v<U>, bool> = true>
-        T min() const {
-            return *std::min_element(begin(), end());
+        std::size_t count() const {
+            return df::count(m_d, m_size, 1, valid_words());
         }
 
+        // null values are equal to each other and to nothing else.
         bool is_equal_with(const Series& other) const {
             FORCED_ASSERT(m_size == other.m_size, "comparaison operation on nonmatching size objects");
+            if (m_validity || other.m_validity) {
+                for (std::size_t i = 0; i < m_size; i++) {
+                    if (is_valid(i) != other.is_valid(i) || (is_valid(i) && m_d[i] != other[i])) { return false; }
+                }
+                return true;
+            }
             for (std::size_t i = 0; i < m_size; i++) {
                 if (m_d[i] != other[i]) { return false; }
             }
@@ -386,10 +338,43 @@ namespace df {
         }
 
       private:
+        const std::uint64_t* valid_words() const {
+            return m_validity ? m_validity->words() : nullptr;
+        }
+
+        template<typename Rhs>
+        void merge_validity(const Rhs& rhs) {
+            if constexpr (expression<Rhs>) {
+                std::optional<Mask> valid = combined_validity(rhs);
+                if (!valid) { return; }
+                if (m_validity) {
+                    *m_validity &= *valid;
+                } else {
+                    m_validity = std::move(valid);
+                }
+            }
+        }
+
+        template<typename... Ts>
+            requires(sizeof...(Ts) > 0)
+        friend class TypedDataFrame;
+
         data_type*  m_d;
         std::size_t m_size;
+        // empty when every value is valid.
+        std::optional<Mask> m_validity;
+        // set by the frame that owns the series, which needs every column to keep row_count values. not copied or moved.
+        bool m_fixed_size = false;
     };
 
+    inline Series<bool> Mask::to_series() const {
+        Series<bool> series(m_size);
+        for (std::size_t i = 0; i < m_size; i++) {
+            series[i] = (*this)[i];
+        }
+        return series;
+    }
+
 } // namespace df
 
 #endif // DATA_FRAME_SERIES_H
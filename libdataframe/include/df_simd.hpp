@@ -0,0 +1,657 @@
+#ifndef DATA_FRAME_SIMD_H
+#define DATA_FRAME_SIMD_H
+
+#include "df_common.hpp"
+
+#include <atomic>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define DF_SIMD_X86 1
+#else
+    #define DF_SIMD_X86 0
+#endif
+
+#if DF_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+namespace df {
+    namespace simd {
+
+        /*
+         element-wise kernels over contiguous buffers (Series::data(), column major columns, the frame buffer).
+         every kernel is compiled once per instruction set with a target attribute and the widest one the cpu supports
+         is picked at runtime, the kernel bodies use compiler vector types so one body serves every width.
+         on other compilers/architectures only the scalar loops are built.
+        */
+
+        enum class Level {
+            Scalar,
+            SSE42,
+            AVX2,
+            AVX512
+        };
+
+        inline const char* level_name(Level level) {
+            switch (level) {
+                case Level::Scalar: return "scalar";
+                case Level::SSE42: return "sse4.2";
+                case Level::AVX2: return "avx2";
+                case Level::AVX512: return "avx512";
+            }
+            return "unknown";
+        }
+
+        inline Level detect_level() {
+#if DF_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512bw")) {
+                return Level::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) { return Level::AVX2; }
+            if (__builtin_cpu_supports("sse4.2")) { return Level::SSE42; }
+#endif
+            return Level::Scalar;
+        }
+
+        // the level used by the kernels, defaults to the best one of this cpu. can be lowered for testing and benchmarks,
+        // raising it above detect_level() is clamped.
+        inline std::atomic<Level>& active_level_ref() {
+            static std::atomic<Level> level{detect_level()};
+            return level;
+        }
+
+        inline Level active_level() {
+            return active_level_ref().load(std::memory_order_relaxed);
+        }
+
+        inline void set_level(Level level) {
+            active_level_ref().store(std::min(level, detect_level()), std::memory_order_relaxed);
+        }
+
+        template<typename T>
+        concept vectorizable = std::same_as<T, float> || std::same_as<T, double> || std::same_as<T, std::int32_t> || std::same_as<T, std::int64_t>;
+
+        // the floating point types of the reduction kernels, integer sums are exact and stay on plain loops.
+        template<typename T>
+        concept reducible = std::same_as<T, float> || std::same_as<T, double>;
+
+        // what a reduction folds: the values, their squared deviations from a center (variance) or their product.
+        enum class Fold {
+            Sum,
+            SquaredDeviation,
+            Product
+        };
+
+        template<typename Op>
+        concept arithmetic_op = std::same_as<Op, std::plus<>> || std::same_as<Op, std::minus<>> || std::same_as<Op, std::multiplies<>>
+                             || std::same_as<Op, std::divides<>>;
+
+        template<typename Op>
+        concept comparison_op = std::same_as<Op, std::equal_to<>> || std::same_as<Op, std::not_equal_to<>> || std::same_as<Op, std::less<>>
+                             || std::same_as<Op, std::less_equal<>> || std::same_as<Op, std::greater<>> || std::same_as<Op, std::greater_equal<>>;
+
+        // integer division has no vector instruction, it stays on the scalar loop.
+        template<typename Op, typename T>
+        inline constexpr bool has_kernel = vectorizable<T> && (comparison_op<Op> || (arithmetic_op<Op> && !(std::same_as<Op, std::divides<>> && std::is_integral_v<T>)));
+
+        // one side of a binary kernel, either a buffer or a value broadcast to every lane.
+        template<typename T>
+        struct Operand {
+            const T* data;
+            T        value;
+
+            static Operand buffer(const T* data) {
+                return {data, T{}};
+            }
+
+            static Operand scalar(const T& value) {
+                return {nullptr, value};
+            }
+
+            bool is_scalar() const {
+                return data == nullptr;
+            }
+
+            Operand advanced(std::size_t count) const {
+                return {is_scalar() ? nullptr : data + count, value};
+            }
+        };
+
+        namespace detail {
+
+            template<typename T, std::size_t Bytes>
+            struct vector {
+                using type [[gnu::vector_size(Bytes)]] = T;
+            };
+
+            template<typename T, std::size_t Bytes>
+            using vector_t = typename vector<T, Bytes>::type;
+
+            // clang-format off
+            // result through an out parameter, vector types are never returned by value.
+            template<typename Op, typename L, typename R, typename Res>
+            [[gnu::always_inline]] inline void apply(const L& lhs, const R& rhs, Res& res) {
+                if constexpr (std::same_as<Op, std::plus<>>) { res = lhs + rhs; }
+                else if constexpr (std::same_as<Op, std::minus<>>) { res = lhs - rhs; }
+                else if constexpr (std::same_as<Op, std::multiplies<>>) { res = lhs * rhs; }
+                else if constexpr (std::same_as<Op, std::divides<>>) { res = lhs / rhs; }
+                else if constexpr (std::same_as<Op, std::equal_to<>>) { res = lhs == rhs; }
+                else if constexpr (std::same_as<Op, std::not_equal_to<>>) { res = lhs != rhs; }
+                else if constexpr (std::same_as<Op, std::less<>>) { res = lhs < rhs; }
+                else if constexpr (std::same_as<Op, std::less_equal<>>) { res = lhs <= rhs; }
+                else if constexpr (std::same_as<Op, std::greater<>>) { res = lhs > rhs; }
+                else { res = lhs >= rhs; }
+            }
+            // clang-format on
+
+            // Bytes == 0 is the scalar loop. Out is T for arithmetic and bool for comparisons.
+            template<std::size_t Bytes, typename Op, bool LhsScalar, bool RhsScalar, typename T, typename Out>
+            [[gnu::always_inline]] inline void binary_body(Operand<T> lhs, Operand<T> rhs, Out* out, std::size_t size) {
+                std::size_t i = 0;
+                if constexpr (Bytes != 0) {
+                    using vec                   = vector_t<T, Bytes>;
+                    constexpr std::size_t lanes = Bytes / sizeof(T);
+
+                    vec lhs_vec = {};
+                    vec rhs_vec = {};
+                    if constexpr (LhsScalar) { lhs_vec = lhs_vec + lhs.value; }
+                    if constexpr (RhsScalar) { rhs_vec = rhs_vec + rhs.value; }
+
+                    for (; i + lanes <= size; i += lanes) {
+                        if constexpr (!LhsScalar) { __builtin_memcpy(&lhs_vec, lhs.data + i, Bytes); }
+                        if constexpr (!RhsScalar) { __builtin_memcpy(&rhs_vec, rhs.data + i, Bytes); }
+                        std::conditional_t<comparison_op<Op>, decltype(lhs_vec < rhs_vec), vec> res;
+                        apply<Op>(lhs_vec, rhs_vec, res);
+                        if constexpr (std::same_as<Out, bool>) {
+                            // lanes are all ones or zero, narrowed to one 0/1 byte per bool.
+                            auto bytes = __builtin_convertvector(res, vector_t<std::uint8_t, lanes>) & 1;
+                            __builtin_memcpy(out + i, &bytes, lanes);
+                        } else {
+                            __builtin_memcpy(out + i, &res, Bytes);
+                        }
+                    }
+                }
+                for (; i < size; i++) {
+                    apply<Op>(LhsScalar ? lhs.value : lhs.data[i], RhsScalar ? rhs.value : rhs.data[i], out[i]);
+                }
+            }
+
+            // true when candidate takes the place of best in a min (Max = false) or max, NaN never replaces a number and any
+            // number replaces a NaN, so a run keeps its extremum whatever the position of its NaNs.
+            template<bool Max, typename T>
+            [[gnu::always_inline]] inline bool improves(const T& candidate, const T& best) {
+                if constexpr (std::is_floating_point_v<T>) {
+                    if (best != best) { return candidate == candidate; }
+                }
+                return Max ? candidate > best : candidate < best;
+            }
+
+            template<std::size_t Bytes, typename T, bool Max>
+            [[gnu::always_inline]] inline T extremum_body(const T* data, std::size_t size) {
+                T           best = data[0];
+                std::size_t i    = 0;
+                if constexpr (Bytes != 0) {
+                    using vec                   = vector_t<T, Bytes>;
+                    constexpr std::size_t lanes = Bytes / sizeof(T);
+                    using mask                  = decltype(vec{} < vec{});
+                    if (size >= lanes) {
+                        vec acc;
+                        __builtin_memcpy(&acc, data, Bytes);
+                        for (i = lanes; i + lanes <= size; i += lanes) {
+                            vec v;
+                            __builtin_memcpy(&v, data + i, Bytes);
+                            // bitwise blend on the lane masks, the comparison yields all ones where v wins or the lane holds a NaN.
+                            mask take = Max ? v > acc : v < acc;
+                            if constexpr (std::is_floating_point_v<T>) { take |= acc != acc; }
+                            mask acc_bits;
+                            mask v_bits;
+                            __builtin_memcpy(&acc_bits, &acc, Bytes);
+                            __builtin_memcpy(&v_bits, &v, Bytes);
+                            acc_bits ^= (acc_bits ^ v_bits) & take;
+                            __builtin_memcpy(&acc, &acc_bits, Bytes);
+                        }
+                        best = acc[0];
+                        for (std::size_t lane = 1; lane < lanes; lane++) {
+                            if (improves<Max>(acc[lane], best)) { best = acc[lane]; }
+                        }
+                    }
+                }
+                for (; i < size; i++) {
+                    if (improves<Max>(data[i], best)) { best = data[i]; }
+                }
+                return best;
+            }
+
+            template<std::size_t Bytes, typename T>
+            [[gnu::always_inline]] inline void fill_body(T* out, const T& value, std::size_t size) {
+                std::size_t i = 0;
+                if constexpr (Bytes != 0) {
+                    using vec                   = vector_t<T, Bytes>;
+                    constexpr std::size_t lanes = Bytes / sizeof(T);
+                    vec                   v     = {};
+                    v                           = v + value;
+                    for (; i + lanes <= size; i += lanes) {
+                        __builtin_memcpy(out + i, &v, Bytes);
+                    }
+                }
+                for (; i < size; i++) {
+                    out[i] = value;
+                }
+            }
+
+            // one comparison per bit, block of 64 elements at a time: the comparison writes 0/1 bytes and a movemask packs them into a word.
+            template<std::size_t Bytes, typename Op, bool LhsScalar, bool RhsScalar, typename T, typename Pack>
+            [[gnu::always_inline]] inline void compare_bits_body(Operand<T> lhs, Operand<T> rhs, std::uint64_t* words, std::size_t size, Pack pack) {
+                alignas(64) bool bytes[64];
+                for (std::size_t base = 0, word = 0; base < size; base += 64, word++) {
+                    std::size_t count = std::min<std::size_t>(64, size - base);
+                    binary_body<Bytes, Op, LhsScalar, RhsScalar>(lhs.advanced(base), rhs.advanced(base), bytes, count);
+                    for (std::size_t i = count; i < 64; i++) {
+                        bytes[i] = false;
+                    }
+                    words[word] = pack(bytes);
+                }
+            }
+
+            inline std::uint64_t pack_bits_scalar(const bool* bytes) {
+                std::uint64_t bits = 0;
+                for (std::size_t i = 0; i < 64; i++) {
+                    bits |= static_cast<std::uint64_t>(bytes[i]) << i;
+                }
+                return bits;
+            }
+
+#if DF_SIMD_X86
+            // the 0/1 bytes are shifted into the sign bit that movemask collects.
+            [[gnu::target("sse4.2")]] inline std::uint64_t pack_bits_sse42(const bool* bytes) {
+                std::uint64_t bits = 0;
+                for (std::size_t i = 0; i < 4; i++) {
+                    __m128i v;
+                    __builtin_memcpy(&v, bytes + (i * 16), 16);
+                    bits |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_slli_epi16(v, 7)))) << (i * 16);
+                }
+                return bits;
+            }
+
+            [[gnu::target("avx2")]] inline std::uint64_t pack_bits_avx2(const bool* bytes) {
+                __m256i low;
+                __m256i high;
+                __builtin_memcpy(&low, bytes, 32);
+                __builtin_memcpy(&high, bytes + 32, 32);
+                auto low_bits  = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(low, 7)));
+                auto high_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(high, 7)));
+                return static_cast<std::uint64_t>(low_bits) | (static_cast<std::uint64_t>(high_bits) << 32);
+            }
+
+            [[gnu::target("avx512f,avx512dq,avx512bw")]] inline std::uint64_t pack_bits_avx512(const bool* bytes) {
+                __m512i v;
+                __builtin_memcpy(&v, bytes, 64);
+                return _mm512_test_epi8_mask(v, v);
+            }
+#endif
+
+            template<Fold F, typename V>
+            [[gnu::always_inline]] inline void fold_term(const V& x, const V& center, V& term) {
+                if constexpr (F == Fold::SquaredDeviation) {
+                    term = (x - center) * (x - center);
+                } else {
+                    term = x;
+                }
+            }
+
+            template<Fold F, typename V>
+            [[gnu::always_inline]] inline void fold_into(V& acc, const V& term) {
+                if constexpr (F == Fold::Product) {
+                    acc = acc * term;
+                } else {
+                    acc = acc + term;
+                }
+            }
+
+            // four independent vector accumulators hide the add latency, lanes are combined at the end.
+            template<std::size_t Bytes, Fold F, typename T>
+            [[gnu::always_inline]] inline T reduce_body(const T* data, std::size_t size, T center) {
+                const T     identity = F == Fold::Product ? T{1} : T{0};
+                T           result   = identity;
+                std::size_t i        = 0;
+                if constexpr (Bytes != 0) {
+                    using vec                    = vector_t<T, Bytes>;
+                    constexpr std::size_t lanes  = Bytes / sizeof(T);
+                    constexpr std::size_t unroll = 4;
+
+                    vec center_vec = {};
+                    center_vec     = center_vec + center;
+                    vec acc[unroll];
+                    for (auto& a : acc) {
+                        a = vec{} + identity;
+                    }
+
+                    for (; i + (unroll * lanes) <= size; i += unroll * lanes) {
+                        for (std::size_t k = 0; k < unroll; k++) {
+                            vec x;
+                            vec term;
+                            __builtin_memcpy(&x, data + i + (k * lanes), Bytes);
+                            fold_term<F>(x, center_vec, term);
+                            fold_into<F>(acc[k], term);
+                        }
+                    }
+                    for (; i + lanes <= size; i += lanes) {
+                        vec x;
+                        vec term;
+                        __builtin_memcpy(&x, data + i, Bytes);
+                        fold_term<F>(x, center_vec, term);
+                        fold_into<F>(acc[0], term);
+                    }
+                    fold_into<F>(acc[0], acc[1]);
+                    fold_into<F>(acc[2], acc[3]);
+                    fold_into<F>(acc[0], acc[2]);
+                    for (std::size_t lane = 0; lane < lanes; lane++) {
+                        fold_into<F>(result, static_cast<T>(acc[0][lane]));
+                    }
+                }
+                for (; i < size; i++) {
+                    T term;
+                    fold_term<F>(data[i], center, term);
+                    fold_into<F>(result, term);
+                }
+                return result;
+            }
+
+            // Neumaier's variant of Kahan summation, the compensation also covers terms larger than the running sum.
+            template<typename T>
+            [[gnu::always_inline]] inline void neumaier_add(T& sum, T& comp, T x) {
+                T t = sum + x;
+                if (std::abs(sum) >= std::abs(x)) {
+                    comp += (sum - t) + x;
+                } else {
+                    comp += (x - t) + sum;
+                }
+                sum = t;
+            }
+
+            // per lane Neumaier summation, the larger/smaller operand is selected with bitwise blends on the lane masks.
+            // float data is summed in double lanes, a float compensation would lose the error it is meant to keep.
+            template<std::size_t Bytes, Fold F, typename T>
+            [[gnu::always_inline]] inline T compensated_reduce_body(const T* data, std::size_t size, T center) {
+                using wide = std::conditional_t<std::is_same_v<T, float>, double, T>;
+
+                wide        sum  = 0;
+                wide        comp = 0;
+                std::size_t i    = 0;
+                if constexpr (Bytes != 0) {
+                    using vec                   = vector_t<wide, Bytes>;
+                    using mask                  = decltype(vec{} < vec{});
+                    constexpr std::size_t lanes = Bytes / sizeof(wide);
+
+                    vec  center_vec = vec{} + static_cast<wide>(center);
+                    vec  s          = {};
+                    vec  c          = {};
+                    vec  neg_zero   = -vec{}; // 0.0 + -0.0 would round to +0.0
+                    mask sign_bits;
+                    __builtin_memcpy(&sign_bits, &neg_zero, Bytes);
+
+                    for (; i + lanes <= size; i += lanes) {
+                        vec x;
+                        vec term;
+                        if constexpr (std::is_same_v<T, wide>) {
+                            __builtin_memcpy(&x, data + i, Bytes);
+                        } else {
+                            vector_t<T, lanes * sizeof(T)> narrow;
+                            __builtin_memcpy(&narrow, data + i, lanes * sizeof(T));
+                            x = __builtin_convertvector(narrow, vec);
+                        }
+                        fold_term<F>(x, center_vec, term);
+                        vec  t = s + term;
+                        mask s_bits;
+                        mask term_bits;
+                        __builtin_memcpy(&s_bits, &s, Bytes);
+                        __builtin_memcpy(&term_bits, &term, Bytes);
+
+                        vec  abs_s;
+                        vec  abs_term;
+                        mask abs_s_bits    = s_bits & ~sign_bits;
+                        mask abs_term_bits = term_bits & ~sign_bits;
+                        __builtin_memcpy(&abs_s, &abs_s_bits, Bytes);
+                        __builtin_memcpy(&abs_term, &abs_term_bits, Bytes);
+
+                        mask s_larger   = abs_s >= abs_term;
+                        mask large_bits = (s_bits & s_larger) | (term_bits & ~s_larger);
+                        mask small_bits = (term_bits & s_larger) | (s_bits & ~s_larger);
+                        vec  large;
+                        vec  small;
+                        __builtin_memcpy(&large, &large_bits, Bytes);
+                        __builtin_memcpy(&small, &small_bits, Bytes);
+
+                        c = c + ((large - t) + small);
+                        s = t;
+                    }
+                    // the lane sums first so that large opposite lanes cancel before the compensations are added.
+                    for (std::size_t lane = 0; lane < lanes; lane++) {
+                        neumaier_add(sum, comp, static_cast<wide>(s[lane]));
+                    }
+                    for (std::size_t lane = 0; lane < lanes; lane++) {
+                        neumaier_add(sum, comp, static_cast<wide>(c[lane]));
+                    }
+                }
+                for (; i < size; i++) {
+                    wide term;
+                    fold_term<F>(static_cast<wide>(data[i]), static_cast<wide>(center), term);
+                    neumaier_add(sum, comp, term);
+                }
+                return static_cast<T>(sum + comp);
+            }
+
+#define DF_SIMD_KERNELS(SUFFIX, BYTES, TARGET)                                                                                                      \
+    template<typename Op, bool LhsScalar, bool RhsScalar, typename T, typename Out>                                                                 \
+    TARGET void binary_##SUFFIX(Operand<T> lhs, Operand<T> rhs, Out* out, std::size_t size) {                                                       \
+        binary_body<BYTES, Op, LhsScalar, RhsScalar>(lhs, rhs, out, size);                                                                          \
+    }                                                                                                                                               \
+    template<typename T, bool Max>                                                                                                                  \
+    TARGET T extremum_##SUFFIX(const T* data, std::size_t size) {                                                                                   \
+        return extremum_body<BYTES, T, Max>(data, size);                                                                                            \
+    }                                                                                                                                               \
+    template<typename T>                                                                                                                            \
+    TARGET void fill_##SUFFIX(T* out, const T& value, std::size_t size) {                                                                           \
+        fill_body<BYTES>(out, value, size);                                                                                                         \
+    }                                                                                                                                               \
+    template<typename Op, bool LhsScalar, bool RhsScalar, typename T>                                                                               \
+    TARGET void compare_bits_##SUFFIX(Operand<T> lhs, Operand<T> rhs, std::uint64_t* words, std::size_t size) {                                     \
+        compare_bits_body<BYTES, Op, LhsScalar, RhsScalar>(lhs, rhs, words, size, pack_bits_##SUFFIX);                                              \
+    }                                                                                                                                               \
+    template<Fold F, typename T>                                                                                                                    \
+    TARGET T reduce_##SUFFIX(const T* data, std::size_t size, T center) {                                                                           \
+        return reduce_body<BYTES, F>(data, size, center);                                                                                           \
+    }                                                                                                                                               \
+    template<Fold F, typename T>                                                                                                                    \
+    TARGET T compensated_reduce_##SUFFIX(const T* data, std::size_t size, T center) {                                                               \
+        return compensated_reduce_body<BYTES, F>(data, size, center);                                                                               \
+    }
+
+            DF_SIMD_KERNELS(scalar, 0, )
+#if DF_SIMD_X86
+            DF_SIMD_KERNELS(sse42, 16, [[gnu::target("sse4.2")]])
+            DF_SIMD_KERNELS(avx2, 32, [[gnu::target("avx2")]])
+            DF_SIMD_KERNELS(avx512, 64, [[gnu::target("avx512f,avx512dq,avx512bw")]])
+#endif
+
+#undef DF_SIMD_KERNELS
+
+            template<typename Op, bool LhsScalar, bool RhsScalar, typename T, typename Out>
+            void binary_dispatch(Operand<T> lhs, Operand<T> rhs, Out* out, std::size_t size) {
+#if DF_SIMD_X86
+                switch (active_level()) {
+                    case Level::AVX512: return binary_avx512<Op, LhsScalar, RhsScalar>(lhs, rhs, out, size);
+                    case Level::AVX2: return binary_avx2<Op, LhsScalar, RhsScalar>(lhs, rhs, out, size);
+                    case Level::SSE42: return binary_sse42<Op, LhsScalar, RhsScalar>(lhs, rhs, out, size);
+                    case Level::Scalar: break;
+                }
+#endif
+                binary_scalar<Op, LhsScalar, RhsScalar>(lhs, rhs, out, size);
+            }
+
+            template<typename Op, bool LhsScalar, bool RhsScalar, typename T>
+            void compare_bits_dispatch(Operand<T> lhs, Operand<T> rhs, std::uint64_t* words, std::size_t size) {
+#if DF_SIMD_X86
+                switch (active_level()) {
+                    case Level::AVX512: return compare_bits_avx512<Op, LhsScalar, RhsScalar>(lhs, rhs, words, size);
+                    case Level::AVX2: return compare_bits_avx2<Op, LhsScalar, RhsScalar>(lhs, rhs, words, size);
+                    case Level::SSE42: return compare_bits_sse42<Op, LhsScalar, RhsScalar>(lhs, rhs, words, size);
+                    case Level::Scalar: break;
+                }
+#endif
+                compare_bits_scalar<Op, LhsScalar, RhsScalar>(lhs, rhs, words, size);
+            }
+
+        } // namespace detail
+
+        // out[i] = Op(lhs[i], rhs[i]) for arithmetic Ops, out must be T for those and bool for comparisons.
+        // out may alias lhs or rhs.
+        template<typename Op, typename T, typename Out>
+            requires(has_kernel<Op, T>)
+        void binary(Operand<T> lhs, Operand<T> rhs, Out* out, std::size_t size) {
+            if (lhs.is_scalar() && rhs.is_scalar()) {
+                Out value;
+                detail::apply<Op>(lhs.value, rhs.value, value);
+                detail::fill_scalar(out, value, size);
+            } else if (lhs.is_scalar()) {
+                detail::binary_dispatch<Op, true, false>(lhs, rhs, out, size);
+            } else if (rhs.is_scalar()) {
+                detail::binary_dispatch<Op, false, true>(lhs, rhs, out, size);
+            } else {
+                detail::binary_dispatch<Op, false, false>(lhs, rhs, out, size);
+            }
+        }
+
+        // bit i % 64 of words[i / 64] = Op(lhs[i], rhs[i]), the bits past size in the last word are cleared.
+        template<typename Op, vectorizable T>
+            requires(comparison_op<Op>)
+        void compare_bits(Operand<T> lhs, Operand<T> rhs, std::uint64_t* words, std::size_t size) {
+            if (lhs.is_scalar() && rhs.is_scalar()) {
+                detail::compare_bits_dispatch<Op, true, true>(lhs, rhs, words, size);
+            } else if (lhs.is_scalar()) {
+                detail::compare_bits_dispatch<Op, true, false>(lhs, rhs, words, size);
+            } else if (rhs.is_scalar()) {
+                detail::compare_bits_dispatch<Op, false, true>(lhs, rhs, words, size);
+            } else {
+                detail::compare_bits_dispatch<Op, false, false>(lhs, rhs, words, size);
+            }
+        }
+
+        namespace detail {
+            inline std::size_t mask_indices_scalar(const std::uint64_t* words, std::size_t word_count, std::size_t* out) {
+                std::size_t count = 0;
+                for (std::size_t w = 0; w < word_count; w++) {
+                    for (std::uint64_t word = words[w]; word != 0; word &= word - 1) {
+                        out[count++] = (w * 64) + static_cast<std::size_t>(std::countr_zero(word));
+                    }
+                }
+                return count;
+            }
+
+#if DF_SIMD_X86 && defined(__x86_64__)
+            // compresses the 8 indices of each mask byte into the set ones, empty words are skipped.
+            [[gnu::target("avx512f,avx512dq,avx512bw")]] inline std::size_t mask_indices_avx512(const std::uint64_t* words,
+                                                                                                 std::size_t          word_count,
+                                                                                                 std::size_t*         out) {
+                const __m512i step  = _mm512_set1_epi64(8);
+                std::size_t   count = 0;
+                for (std::size_t w = 0; w < word_count; w++) {
+                    std::uint64_t word = words[w];
+                    if (word == 0) { continue; }
+                    __m512i idx = _mm512_add_epi64(_mm512_set1_epi64(static_cast<long long>(w * 64)), _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7));
+                    for (std::size_t byte = 0; byte < 8; byte++) {
+                        auto bits = static_cast<__mmask8>(word >> (byte * 8));
+                        _mm512_storeu_si512(out + count, _mm512_maskz_compress_epi64(bits, idx));
+                        count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(bits)));
+                        idx = _mm512_add_epi64(idx, step);
+                    }
+                }
+                return count;
+            }
+#endif
+        } // namespace detail
+
+        // extra room mask_indices() may write past the last index.
+        inline constexpr std::size_t mask_indices_slack = 8;
+
+        // writes the positions of the set bits in ascending order to out and returns their count (the selection vector of a mask).
+        // out needs room for the count plus mask_indices_slack entries.
+        inline std::size_t mask_indices(const std::uint64_t* words, std::size_t word_count, std::size_t* out) {
+#if DF_SIMD_X86 && defined(__x86_64__)
+            if (active_level() == Level::AVX512) { return detail::mask_indices_avx512(words, word_count, out); }
+#endif
+            return detail::mask_indices_scalar(words, word_count, out);
+        }
+
+        template<vectorizable T, bool Max>
+        T extremum(const T* data, std::size_t size) {
+            FORCED_ASSERT(size > 0, "min/max of an empty buffer");
+#if DF_SIMD_X86
+            switch (active_level()) {
+                case Level::AVX512: return detail::extremum_avx512<T, Max>(data, size);
+                case Level::AVX2: return detail::extremum_avx2<T, Max>(data, size);
+                case Level::SSE42: return detail::extremum_sse42<T, Max>(data, size);
+                case Level::Scalar: break;
+            }
+#endif
+            return detail::extremum_scalar<T, Max>(data, size);
+        }
+
+        // folds data[0, size) with independent accumulators per lane, e.g. reduce<Fold::Sum>(data, size).
+        // the order of the additions depends on the level, results may differ in the last bits between levels.
+        template<Fold F, reducible T>
+        T reduce(const T* data, std::size_t size, T center = T{}) {
+#if DF_SIMD_X86
+            switch (active_level()) {
+                case Level::AVX512: return detail::reduce_avx512<F>(data, size, center);
+                case Level::AVX2: return detail::reduce_avx2<F>(data, size, center);
+                case Level::SSE42: return detail::reduce_sse42<F>(data, size, center);
+                case Level::Scalar: break;
+            }
+#endif
+            return detail::reduce_scalar<F>(data, size, center);
+        }
+
+        // like reduce() with a Neumaier compensated sum per lane, F is Fold::Sum or Fold::SquaredDeviation.
+        template<Fold F, reducible T>
+            requires(F != Fold::Product)
+        T compensated_reduce(const T* data, std::size_t size, T center = T{}) {
+#if DF_SIMD_X86
+            switch (active_level()) {
+                case Level::AVX512: return detail::compensated_reduce_avx512<F>(data, size, center);
+                case Level::AVX2: return detail::compensated_reduce_avx2<F>(data, size, center);
+                case Level::SSE42: return detail::compensated_reduce_sse42<F>(data, size, center);
+                case Level::Scalar: break;
+            }
+#endif
+            return detail::compensated_reduce_scalar<F>(data, size, center);
+        }
+
+        template<vectorizable T>
+        T min(const T* data, std::size_t size) {
+            return extremum<T, false>(data, size);
+        }
+
+        template<vectorizable T>
+        T max(const T* data, std::size_t size) {
+            return extremum<T, true>(data, size);
+        }
+
+        template<vectorizable T>
+        void fill(T* out, const T& value, std::size_t size) {
+#if DF_SIMD_X86
+            switch (active_level()) {
+                case Level::AVX512: return detail::fill_avx512(out, value, size);
+                case Level::AVX2: return detail::fill_avx2(out, value, size);
+                case Level::SSE42: return detail::fill_sse42(out, value, size);
+                case Level::Scalar: break;
+            }
+#endif
+            detail::fill_scalar(out, value, size);
+        }
+
+    } // namespace simd
+} // namespace df
+
+#endif // DATA_FRAME_SIMD_H
@@ -0,0 +1,435 @@
+#ifndef DATA_FRAME_SORT_H
+#define DATA_FRAME_SORT_H
+
+#include "df_common.hpp"
+#include "df_parallel.hpp"
+
+namespace df {
+
+    // below this many rows the radix passes cost more than they save.
+    inline constexpr std::size_t radix_sort_threshold = 256;
+
+    template<typename T>
+    concept radix_sortable
+    = std::is_integral_v<T> || (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8));
+
+    template<typename T>
+    using radix_key_t = std::conditional_t<
+    sizeof(T) == 1,
+    std::uint8_t,
+    std::conditional_t<sizeof(T) == 2, std::uint16_t, std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+    // maps a value to an unsigned key with the same ordering, so keys can be sorted byte by byte.
+    // signed integers get their sign bit flipped, negative floats get all bits flipped and positive floats only the sign bit.
+    template<radix_sortable T>
+    constexpr radix_key_t<T> radix_key(T value) {
+        using key_type              = radix_key_t<T>;
+        constexpr key_type sign_bit = key_type{1} << ((sizeof(key_type) * 8) - 1);
+
+        if constexpr (std::is_same_v<T, bool>) {
+            return static_cast<key_type>(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (value == T{0}) { value = T{0}; } // -0.0 and 0.0 compare equal, give them the same key
+            key_type bits = std::bit_cast<key_type>(value);
+            return (bits & sign_bit) ? static_cast<key_type>(~bits) : static_cast<key_type>(bits | sign_bit);
+        } else if constexpr (std::is_signed_v<T>) {
+            return static_cast<key_type>(static_cast<key_type>(value) ^ sign_bit);
+        } else {
+            return static_cast<key_type>(value);
+        }
+    }
+
+    // the key a value sorts by in the given direction, NaN last in both directions and every NaN equal. the radix sort and the
+    // comparison sorts all order by it, so they agree on any key, whatever the row count or the thread count.
+    template<radix_sortable T>
+    constexpr radix_key_t<T> sort_key(T value, bool ascending) {
+        using key_type = radix_key_t<T>;
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(value)) { return std::numeric_limits<key_type>::max(); }
+        }
+        key_type k = radix_key(value);
+        return ascending ? k : static_cast<key_type>(~k);
+    }
+
+    // strict weak order of rows by key[row] in the given direction, through sort_key() for arithmetic keys.
+    template<typename Column>
+    auto key_order(const Column& key, bool ascending) {
+        using data_type = std::remove_cvref_t<decltype(key[std::size_t{0}])>;
+        return [&key, ascending](std::size_t a, std::size_t b) {
+            if constexpr (radix_sortable<data_type>) {
+                return sort_key(key[a], ascending) < sort_key(key[b], ascending);
+            } else {
+                return ascending ? key[a] < key[b] : key[b] < key[a];
+            }
+        };
+    }
+
+    // stable LSD radix sort of rows by keys, 8 bits per pass. keys[i] belongs to rows[i], both are reordered.
+    // passes where every key has the same byte are skipped.
+    template<typename Key>
+    void radix_sort_rows(std::vector<Key>& keys, std::vector<std::size_t>& rows) {
+        constexpr std::size_t key_bytes = sizeof(Key);
+        const std::size_t     n         = keys.size();
+
+        std::vector<std::array<std::size_t, 256>> histograms(key_bytes);
+        for (auto& histogram : histograms) {
+            histogram.fill(0);
+        }
+        for (const Key key : keys) {
+            for (std::size_t byte = 0; byte < key_bytes; byte++) {
+                histograms[byte][(key >> (byte * 8)) & 0xFF]++;
+            }
+        }
+
+        std::vector<Key>         keys_tmp(n);
+        std::vector<std::size_t> rows_tmp(n);
+        for (std::size_t byte = 0; byte < key_bytes; byte++) {
+            auto& histogram = histograms[byte];
+            if (histogram[(keys[0] >> (byte * 8)) & 0xFF] == n) { continue; }
+
+            std::size_t offset = 0;
+            for (auto& count : histogram) {
+                std::size_t bucket_size = count;
+                count                   = offset;
+                offset += bucket_size;
+            }
+
+            for (std::size_t i = 0; i < n; i++) {
+                std::size_t dst = histogram[(keys[i] >> (byte * 8)) & 0xFF]++;
+                keys_tmp[dst]   = keys[i];
+                rows_tmp[dst]   = rows[i];
+            }
+            keys.swap(keys_tmp);
+            rows.swap(rows_tmp);
+        }
+    }
+
+    // stable reorder of rows (frame row indices) by the values key[row], NaN last, see sort_key().
+    // arithmetic keys are radix sorted on a contiguous copy of their keys, other types and short runs use std::stable_sort.
+    template<typename Column>
+    void sort_rows_by(const Column& key, std::vector<std::size_t>& rows, bool ascending) {
+        using data_type = std::remove_cvref_t<decltype(key[std::size_t{0}])>;
+
+        if constexpr (radix_sortable<data_type>) {
+            if (rows.size() >= radix_sort_threshold) {
+                using key_type = radix_key_t<data_type>;
+                std::vector<key_type> keys(rows.size());
+                for (std::size_t i = 0; i < rows.size(); i++) {
+                    keys[i] = sort_key(key[rows[i]], ascending);
+                }
+                radix_sort_rows(keys, rows);
+                return;
+            }
+        }
+
+        std::stable_sort(rows.begin(), rows.end(), key_order(key, ascending));
+    }
+
+    // where the rows with a null key go, whatever the direction of the sort.
+    enum class NullOrder {
+        First,
+        Last
+    };
+
+    // the validity bitmap of a key, nullptr for keys without one (a column without nulls, a plain container).
+    template<typename Column>
+    auto key_validity(const Column& key) {
+        if constexpr (requires { key.validity(); }) {
+            return key.validity();
+        } else {
+            return static_cast<const void*>(nullptr);
+        }
+    }
+
+    // removes the rows whose key is null, the others keep their order.
+    template<typename Column>
+    void drop_null_rows(const Column& key, std::vector<std::size_t>& rows) {
+        if constexpr (requires { key.validity(); }) {
+            if (const auto* valid = key.validity()) {
+                std::erase_if(rows, [valid](std::size_t row) { return !(*valid)[row]; });
+            }
+        }
+    }
+
+    // sort_valid(valid_rows) on the rows whose key is valid, the null rows are put first or last in their order. a key without
+    // nulls goes to sort_valid unchanged, the sort kernels never see a null.
+    template<typename Column, typename SortValid>
+    void sort_rows_with_nulls(const Column& key, std::vector<std::size_t>& rows, NullOrder nulls, SortValid&& sort_valid) {
+        if constexpr (requires { key.validity(); }) {
+            if (const auto* valid = key.validity()) {
+                std::vector<std::size_t> null_rows;
+                auto split = std::stable_partition(rows.begin(), rows.end(), [valid](std::size_t row) { return (*valid)[row]; });
+                null_rows.assign(split, rows.end());
+                rows.erase(split, rows.end());
+                sort_valid(rows);
+                rows.insert(nulls == NullOrder::First ? rows.begin() : rows.end(), null_rows.begin(), null_rows.end());
+                return;
+            }
+        }
+        sort_valid(rows);
+    }
+
+    // below this many rows per thread the parallel sort runs sequentially.
+    inline constexpr std::size_t parallel_sort_grain = 1 << 14;
+
+    // stable parallel merge sort of rows: every thread sorts one contiguous run with sort_run(run), then runs are merged
+    // pairwise, level by level, with less. std::merge takes equal keys from the left run first, so as long as sort_run is
+    // stable and orders by less the result is the same as the sequential sort whatever the thread count.
+    template<typename SortRun, typename Less>
+    void parallel_merge_sort_rows(std::size_t thread_count, std::vector<std::size_t>& rows, SortRun&& sort_run, Less&& less) {
+        const std::size_t n    = rows.size();
+        std::size_t       runs = std::min(resolve_thread_count(thread_count), n / parallel_sort_grain);
+        if (runs <= 1) {
+            sort_run(rows);
+            return;
+        }
+
+        std::vector<std::size_t> bounds(runs + 1);
+        for (std::size_t run = 0; run <= runs; run++) {
+            bounds[run] = (n * run) / runs;
+        }
+
+        parallel_for(
+        0,
+        runs,
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t run = first; run < last; run++) {
+                std::vector<std::size_t> part(rows.begin() + bounds[run], rows.begin() + bounds[run + 1]);
+                sort_run(part);
+                std::copy(part.begin(), part.end(), rows.begin() + bounds[run]);
+            }
+        },
+        runs);
+
+        std::vector<std::size_t> merged(n);
+        while (bounds.size() > 2) {
+            std::size_t pairs = (bounds.size() - 1) / 2;
+            parallel_for(
+            0,
+            bounds.size() - 1,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t run = first; run < last; run++) {
+                    if (run % 2 != 0) { continue; }
+                    auto lo  = rows.begin() + bounds[run];
+                    auto mid = rows.begin() + bounds[run + 1];
+                    if (run + 2 < bounds.size()) {
+                        std::merge(lo, mid, mid, rows.begin() + bounds[run + 2], merged.begin() + bounds[run], less);
+                    } else {
+                        std::copy(lo, mid, merged.begin() + bounds[run]); // odd run out, carried to the next level
+                    }
+                }
+            },
+            pairs + 1);
+            rows.swap(merged);
+
+            std::vector<std::size_t> next_bounds;
+            for (std::size_t i = 0; i < bounds.size(); i += 2) {
+                next_bounds.push_back(bounds[i]);
+            }
+            if (next_bounds.back() != n) { next_bounds.push_back(n); }
+            bounds.swap(next_bounds);
+        }
+    }
+
+    template<typename Column>
+    void sort_rows_by(execution::parallel_policy policy, const Column& key, std::vector<std::size_t>& rows, bool ascending) {
+        parallel_merge_sort_rows(
+        policy.thread_count,
+        rows,
+        [&key, ascending](std::vector<std::size_t>& run) { sort_rows_by(key, run, ascending); },
+        key_order(key, ascending));
+    }
+
+    template<typename Column>
+    void sort_rows_by(execution::sequenced_policy, const Column& key, std::vector<std::size_t>& rows, bool ascending) {
+        sort_rows_by(key, rows, ascending);
+    }
+
+    enum class SortOrder {
+        Ascending,
+        Descending
+    };
+
+    inline constexpr SortOrder asc  = SortOrder::Ascending;
+    inline constexpr SortOrder desc = SortOrder::Descending;
+
+    // one key of a multi column sort, e.g. df.sort({{"col-a", asc}, {"col-b", desc, NullOrder::First}}).
+    struct SortKey {
+        std::string_view column_name;
+        SortOrder        order = SortOrder::Ascending;
+        NullOrder        nulls = NullOrder::Last;
+    };
+
+    // lexicographic order of rows over several key columns, each with its own direction.
+    // the first key that differs decides, rows equal on every key compare equal. two null keys are equal, NaN sorts last.
+    template<typename Column>
+    class MultiKeyLess {
+      public:
+        void add(Column key, SortOrder order, NullOrder nulls = NullOrder::Last) {
+            auto valid = key_validity(key);
+            m_keys.push_back({std::move(key), order == SortOrder::Ascending, nulls == NullOrder::First, valid});
+        }
+
+        bool operator()(std::size_t a, std::size_t b) const {
+            for (const auto& [key, ascending, nulls_first, valid] : m_keys) {
+                if constexpr (!std::is_same_v<validity_type, const void*>) {
+                    if (valid) {
+                        bool a_valid = (*valid)[a];
+                        bool b_valid = (*valid)[b];
+                        if (a_valid != b_valid) { return a_valid != nulls_first; }
+                        if (!a_valid) { continue; }
+                    }
+                }
+                const auto& a_val = key[a];
+                const auto& b_val = key[b];
+                if constexpr (radix_sortable<std::remove_cvref_t<decltype(a_val)>>) {
+                    auto a_key = sort_key(a_val, ascending);
+                    auto b_key = sort_key(b_val, ascending);
+                    if (a_key != b_key) { return a_key < b_key; }
+                } else {
+                    if (a_val < b_val) { return ascending; }
+                    if (b_val < a_val) { return !ascending; }
+                }
+            }
+            return false;
+        }
+
+        std::size_t size() const {
+            return m_keys.size();
+        }
+
+      private:
+        using validity_type = decltype(key_validity(std::declval<const Column&>()));
+
+        struct Key {
+            Column        column;
+            bool          ascending;
+            bool          nulls_first;
+            validity_type valid;
+        };
+
+        std::vector<Key> m_keys;
+    };
+
+    // stable reorder of rows by several keys in one sort over the permutation.
+    template<typename Column>
+    void sort_rows_by(const MultiKeyLess<Column>& less, std::vector<std::size_t>& rows) {
+        std::stable_sort(rows.begin(), rows.end(), less);
+    }
+
+    template<typename Column>
+    void sort_rows_by(execution::parallel_policy policy, const MultiKeyLess<Column>& less, std::vector<std::size_t>& rows) {
+        parallel_merge_sort_rows(
+        policy.thread_count, rows, [&less](std::vector<std::size_t>& run) { sort_rows_by(less, run); }, less);
+    }
+
+    template<typename Column>
+    void sort_rows_by(execution::sequenced_policy, const MultiKeyLess<Column>& less, std::vector<std::size_t>& rows) {
+        sort_rows_by(less, rows);
+    }
+
+    // positions in [first, last) of the k first entries in the order given by before, sorted. before must be a strict
+    // total order. keeps a bounded heap of the k best positions seen so far, O(n log k) time and O(k) memory.
+    template<typename Before>
+    std::vector<std::size_t> top_k_positions(std::size_t first, std::size_t last, std::size_t k, const Before& before) {
+        std::vector<std::size_t> heap;
+        heap.reserve(k);
+        if (k == 0) { return heap; }
+
+        for (std::size_t pos = first; pos < last; pos++) {
+            if (heap.size() < k) {
+                heap.push_back(pos);
+                std::push_heap(heap.begin(), heap.end(), before);
+            } else if (before(pos, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), before);
+                heap.back() = pos;
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+        }
+        std::sort_heap(heap.begin(), heap.end(), before);
+        return heap;
+    }
+
+    // order of positions in rows used by the top k selection, largest or smallest key first and NaN last, as in the sorts.
+    // equal keys keep the order they have in rows.
+    template<typename Column>
+    auto top_k_order(const Column& key, const std::vector<std::size_t>& rows, bool largest) {
+        return [&rows, largest, less = key_order(key, !largest)](std::size_t a, std::size_t b) {
+            if (less(rows[a], rows[b])) { return true; }
+            if (less(rows[b], rows[a])) { return false; }
+            return a < b;
+        };
+    }
+
+    // keeps the k first rows of the stable order of rows by key, without sorting the rest.
+    template<typename Column>
+    void select_top_k(const Column& key, std::vector<std::size_t>& rows, std::size_t k, bool largest) {
+        k = std::min(k, rows.size());
+
+        std::vector<std::size_t> top = top_k_positions(0, rows.size(), k, top_k_order(key, rows, largest));
+        for (auto& pos : top) {
+            pos = rows[pos];
+        }
+        rows.swap(top);
+    }
+
+    // every thread keeps the top k of its own chunk, the per thread candidates are then reduced to the final k.
+    // the order is total, so the result does not depend on the thread count.
+    template<typename Column>
+    void select_top_k(execution::parallel_policy policy, const Column& key, std::vector<std::size_t>& rows, std::size_t k, bool largest) {
+        k = std::min(k, rows.size());
+
+        std::size_t chunks = std::min(resolve_thread_count(policy.thread_count), rows.size() / parallel_sort_grain);
+        if (chunks <= 1) {
+            select_top_k(key, rows, k, largest);
+            return;
+        }
+
+        auto                                  before = top_k_order(key, rows, largest);
+        std::vector<std::vector<std::size_t>> candidates(chunks);
+        parallel_for(
+        0,
+        chunks,
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t chunk = first; chunk < last; chunk++) {
+                candidates[chunk] = top_k_positions((rows.size() * chunk) / chunks, (rows.size() * (chunk + 1)) / chunks, k, before);
+            }
+        },
+        chunks);
+
+        std::vector<std::size_t> merged;
+        merged.reserve(chunks * k);
+        for (const auto& chunk_top : candidates) {
+            merged.insert(merged.end(), chunk_top.begin(), chunk_top.end());
+        }
+        std::partial_sort(merged.begin(), merged.begin() + k, merged.end(), before);
+
+        std::vector<std::size_t> top(k);
+        for (std::size_t i = 0; i < k; i++) {
+            top[i] = rows[merged[i]];
+        }
+        rows.swap(top);
+    }
+
+    template<typename Column>
+    void select_top_k(execution::sequenced_policy, const Column& key, std::vector<std::size_t>& rows, std::size_t k, bool largest) {
+        select_top_k(key, rows, k, largest);
+    }
+
+    // permutation that orders the values of key, equal values keep their relative order.
+    template<typename Column>
+    std::vector<std::size_t> argsort(const Column& key, bool ascending = true, NullOrder nulls = NullOrder::Last) {
+        return argsort(execution::seq, key, ascending, nulls);
+    }
+
+    template<execution_policy Policy, typename Column>
+    std::vector<std::size_t> argsort(Policy policy, const Column& key, bool ascending = true, NullOrder nulls = NullOrder::Last) {
+        std::vector<std::size_t> perm(key.size());
+        std::iota(perm.begin(), perm.end(), std::size_t{0});
+        sort_rows_with_nulls(key, perm, nulls, [&](std::vector<std::size_t>& rows) { sort_rows_by(policy, key, rows, ascending); });
+        return perm;
+    }
+
+} // namespace df
+
+#endif // DATA_FRAME_SORT_H
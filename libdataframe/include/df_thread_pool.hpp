@@ -0,0 +1,159 @@
+#ifndef DATA_FRAME_THREAD_POOL_H
+#define DATA_FRAME_THREAD_POOL_H
+
+#include "df_common.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace df {
+
+    /*
+     a fixed set of worker threads, each with its own task deque.
+     a task submitted from a worker goes to the back of that worker's deque, a task submitted from any other thread goes to the
+     deques round robin. a worker takes its own tasks from the back, the most recent and still in cache, and steals from the front
+     of the other deques when its own is empty, so nested parallel work stays local while idle workers take the large early chunks.
+     threads waiting for their tasks call run_pending_task() to help instead of blocking, see parallel_for().
+    */
+    class ThreadPool {
+      public:
+        using task_type = std::function<void()>;
+
+        explicit ThreadPool(std::size_t worker_count) : m_queues(std::max<std::size_t>(worker_count, 1)) {
+            for (auto& queue : m_queues) {
+                queue = std::make_unique<Queue>();
+            }
+            m_workers.reserve(worker_count);
+            for (std::size_t worker_idx = 0; worker_idx < worker_count; worker_idx++) {
+                m_workers.emplace_back([this, worker_idx] { worker_loop(worker_idx); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // runs the tasks still queued, then joins the workers.
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(m_wake_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (auto& worker : m_workers) {
+                worker.join();
+            }
+            while (run_pending_task()) {}
+        }
+
+        std::size_t worker_count() const {
+            return m_workers.size();
+        }
+
+        void submit(task_type task) {
+            std::size_t queue_idx = t_pool == this ? t_worker_idx : m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+            m_pending.fetch_add(1, std::memory_order_release);
+            {
+                std::lock_guard lock(m_queues[queue_idx]->mutex);
+                m_queues[queue_idx]->tasks.push_back(std::move(task));
+            }
+            // taking the lock orders the count update before a worker's check-then-wait, no wakeup is lost.
+            { std::lock_guard lock(m_wake_mutex); }
+            m_wake.notify_one();
+        }
+
+        // runs one queued task on the calling thread, false when there was none.
+        bool run_pending_task() {
+            task_type task;
+            if (!try_pop(t_pool == this ? t_worker_idx : 0, task)) { return false; }
+            task();
+            return true;
+        }
+
+      private:
+        struct Queue {
+            std::mutex            mutex;
+            std::deque<task_type> tasks;
+        };
+
+        // the own deque from the back, then the other deques from the front.
+        bool try_pop(std::size_t queue_idx, task_type& task) {
+            if (m_pending.load(std::memory_order_acquire) == 0) { return false; }
+            for (std::size_t i = 0; i < m_queues.size(); i++) {
+                Queue&          queue = *m_queues[(queue_idx + i) % m_queues.size()];
+                std::lock_guard lock(queue.mutex);
+                if (queue.tasks.empty()) { continue; }
+                if (i == 0) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                } else {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                m_pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        void worker_loop(std::size_t worker_idx) {
+            t_pool       = this;
+            t_worker_idx = worker_idx;
+            task_type task;
+            while (true) {
+                if (try_pop(worker_idx, task)) {
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+                std::unique_lock lock(m_wake_mutex);
+                m_wake.wait(lock, [this] { return m_stop || m_pending.load(std::memory_order_acquire) > 0; });
+                if (m_stop && m_pending.load(std::memory_order_acquire) == 0) { return; }
+            }
+        }
+
+        static inline thread_local ThreadPool* t_pool       = nullptr;
+        static inline thread_local std::size_t t_worker_idx = 0;
+
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        std::vector<std::thread>            m_workers;
+        std::atomic<std::size_t>            m_pending{0};
+        std::atomic<std::size_t>            m_next_queue{0};
+        std::mutex                          m_wake_mutex;
+        std::condition_variable             m_wake;
+        bool                                m_stop = false;
+    };
+
+    namespace detail {
+        inline std::atomic<std::size_t> default_pool_thread_count{0};
+        inline std::atomic<bool>        default_pool_started{false};
+    } // namespace detail
+
+    // sets the thread count of the library pool, the calling thread included. only before the pool is first used,
+    // 0 (the default) means one thread per hardware thread.
+    inline void set_default_pool_thread_count(std::size_t thread_count) {
+        FORCED_ASSERT(!detail::default_pool_started.load(), "the default thread pool is already running");
+        detail::default_pool_thread_count.store(thread_count);
+    }
+
+    inline std::size_t resolve_thread_count(std::size_t thread_count) {
+        if (thread_count == 0) { thread_count = detail::default_pool_thread_count.load(); }
+        if (thread_count == 0) { thread_count = std::thread::hardware_concurrency(); }
+        return std::max<std::size_t>(thread_count, 1);
+    }
+
+    // the pool behind parallel_for() and the execution::par overloads, started on first use. the thread that calls
+    // parallel_for() runs a chunk itself, so the pool has one worker less than the thread count.
+    inline ThreadPool& default_pool() {
+        static ThreadPool pool([] {
+            detail::default_pool_started.store(true);
+            return resolve_thread_count(0) - 1;
+        }());
+        return pool;
+    }
+
+} // namespace df
+
+#endif // DATA_FRAME_THREAD_POOL_H
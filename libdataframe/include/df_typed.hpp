@@ -0,0 +1,287 @@
+#ifndef DATA_FRAME_TYPED_H
+#define DATA_FRAME_TYPED_H
+
+#include "df.hpp"
+#include "df_series.hpp"
+
+#include <stdexcept>
+#include <tuple>
+
+namespace df {
+
+    /*
+     a frame whose columns each keep their own type, fixed at compile time, e.g. TypedDataFrame<double, std::int64_t, bool>.
+     column I is a Series of row_count values of the I-th type, stored at the width of that type, so a flag column takes a byte
+     per row instead of the 8 of a DataFrame<double>. each column has the expressions, compound assignments, reductions,
+     iterators and validity of a Series, and the frame keeps a single copy of the row and column labels for all of them.
+     columns are reached by position at compile time, column<I>(), or by name with the type checked at run time, column<T>(name).
+    */
+    template<typename... Ts>
+        requires(sizeof...(Ts) > 0)
+    class TypedDataFrame {
+      public:
+        using column_types = std::tuple<Ts...>;
+
+        template<std::size_t I>
+        using column_data_type = std::tuple_element_t<I, column_types>;
+
+        template<std::size_t I>
+        using column_type = Series<column_data_type<I>>;
+
+        // a row copied out of the frame, a value per column.
+        using row_type = std::tuple<Ts...>;
+
+        // every value starts value initialized.
+        TypedDataFrame(const std::vector<std::string>& col_names, const std::vector<std::string>& row_names)
+            : m_col_labels(col_names),
+              m_row_labels(row_names),
+              m_columns(Series<Ts>(row_names.size())...) {
+            FORCED_ASSERT(col_names.size() == sizeof...(Ts), "column names do not match the column types");
+            for_each_column([](const std::string&, auto& col) {
+                using data_type = typename std::remove_cvref_t<decltype(col)>::data_type;
+                std::fill(col.data(), col.data() + col.size(), data_type{});
+            });
+            fix_column_sizes(true);
+        }
+
+        TypedDataFrame(const TypedDataFrame& other)
+            : m_col_labels(other.m_col_labels),
+              m_row_labels(other.m_row_labels),
+              m_columns(other.m_columns) {
+            fix_column_sizes(true);
+        }
+
+        TypedDataFrame(TypedDataFrame&& other) noexcept
+            : m_col_labels(std::move(other.m_col_labels)),
+              m_row_labels(std::move(other.m_row_labels)),
+              m_columns(std::move(other.m_columns)) {
+            fix_column_sizes(true);
+        }
+
+        // the shapes do not have to match, the columns are replaced.
+        TypedDataFrame& operator=(const TypedDataFrame& other) {
+            if (this != &other) { *this = TypedDataFrame(other); }
+            return *this;
+        }
+
+        TypedDataFrame& operator=(TypedDataFrame&& other) noexcept {
+            if (this != &other) {
+                m_col_labels = std::move(other.m_col_labels);
+                m_row_labels = std::move(other.m_row_labels);
+                fix_column_sizes(false);
+                m_columns = std::move(other.m_columns);
+                fix_column_sizes(true);
+            }
+            return *this;
+        }
+
+        // the columns are Series of row_count() values. they can be changed in place, but assigning a Series or an expression
+        // of another size to one fails, see Series::m_fixed_size.
+        template<std::size_t I>
+        column_type<I>& column() {
+            return std::get<I>(m_columns);
+        }
+
+        template<std::size_t I>
+        const column_type<I>& column() const {
+            return std::get<I>(m_columns);
+        }
+
+        // the column named col_name, which must hold values of type T.
+        template<typename T>
+        Series<T>& column(std::string_view col_name) {
+            return *column_as<T>(*this, get_col_idx(col_name));
+        }
+
+        template<typename T>
+        const Series<T>& column(std::string_view col_name) const {
+            return *column_as<T>(*this, get_col_idx(col_name));
+        }
+
+        template<std::size_t I>
+        column_data_type<I>& at(std::size_t row_idx) {
+            if (row_idx >= row_count()) { throw std::out_of_range("row index out of range"); }
+            return column<I>()[row_idx];
+        }
+
+        template<std::size_t I>
+        const column_data_type<I>& at(std::size_t row_idx) const {
+            if (row_idx >= row_count()) { throw std::out_of_range("row index out of range"); }
+            return column<I>()[row_idx];
+        }
+
+        row_type row(std::size_t row_idx) const {
+            return std::apply([row_idx](const auto&... cols) { return row_type(cols[row_idx]...); }, m_columns);
+        }
+
+        row_type row(std::string_view row_name) const {
+            return row(get_row_idx(row_name));
+        }
+
+        void set_row(std::size_t row_idx, const Ts&... values) {
+            std::apply([row_idx, &values...](auto&... cols) { ((cols[row_idx] = values), ...); }, m_columns);
+        }
+
+        // fn(col_name, col) on every column in order, col is the Series of the column.
+        template<typename Fn>
+        void for_each_column(Fn&& fn) {
+            for_each_column_impl(*this, fn, std::index_sequence_for<Ts...>{});
+        }
+
+        template<typename Fn>
+        void for_each_column(Fn&& fn) const {
+            for_each_column_impl(*this, fn, std::index_sequence_for<Ts...>{});
+        }
+
+        // fn(col) on the Series of the column at col_idx, fn is instantiated for every column type.
+        template<typename Fn>
+        void visit_column(std::size_t col_idx, Fn&& fn) {
+            visit_column_impl(*this, col_idx, fn, std::index_sequence_for<Ts...>{});
+        }
+
+        template<typename Fn>
+        void visit_column(std::size_t col_idx, Fn&& fn) const {
+            visit_column_impl(*this, col_idx, fn, std::index_sequence_for<Ts...>{});
+        }
+
+        std::size_t get_col_idx(std::string_view col) const {
+            return m_col_labels.at(col);
+        }
+
+        std::size_t get_row_idx(std::string_view row) const {
+            return m_row_labels.at(row);
+        }
+
+        const LabelIndex& col_labels() const {
+            return m_col_labels;
+        }
+
+        const LabelIndex& row_labels() const {
+            return m_row_labels;
+        }
+
+        std::size_t col_count() const {
+            return sizeof...(Ts);
+        }
+
+        std::size_t row_count() const {
+            return m_row_labels.size();
+        }
+
+        Shape shape() const {
+            return {.col_count = col_count(), .row_count = row_count()};
+        }
+
+        // bytes held by the column values, the labels and validity bitmaps not included.
+        std::size_t value_bytes() const {
+            return row_count() * (sizeof(Ts) + ...);
+        }
+
+        // a new frame of the given rows in the given order, values and validity of every column gathered.
+        TypedDataFrame take(const std::vector<std::size_t>& rows) const {
+            std::vector<std::string> row_names;
+            row_names.reserve(rows.size());
+            for (std::size_t row_idx : rows) {
+                if (row_idx >= row_count()) { throw std::out_of_range("Take index out of range: " + std::to_string(row_idx)); }
+                row_names.push_back(m_row_labels.name(row_idx));
+            }
+
+            TypedDataFrame result(m_col_labels, LabelIndex(row_names), Series<Ts>(rows.size())...);
+            gather_columns(result, rows, std::index_sequence_for<Ts...>{});
+            return result;
+        }
+
+        // a new frame of the rows whose bit is set, in frame order.
+        TypedDataFrame filter(const Mask& mask) const {
+            FORCED_ASSERT(mask.size() == row_count(), "filter with a mask of nonmatching size");
+            return take(mask.indices());
+        }
+
+        // row permutation that sorts the frame by col_name, see df::argsort().
+        std::vector<std::size_t> argsort(std::string_view col_name, bool ascending = false, NullOrder nulls = NullOrder::Last) const {
+            std::vector<std::size_t> perm;
+            visit_column(get_col_idx(col_name), [&](const auto& col) { perm = df::argsort(col, ascending, nulls); });
+            return perm;
+        }
+
+        // a new frame with the rows ordered by col_name.
+        TypedDataFrame sort(std::string_view col_name, bool ascending = false, NullOrder nulls = NullOrder::Last) const {
+            return take(argsort(col_name, ascending, nulls));
+        }
+
+        // every column converted to T, e.g. to hand the numeric columns of a frame to the DataFrame kernels.
+        template<typename T>
+            requires(std::convertible_to<Ts, T> && ...)
+        DataFrame<T> to_dataframe(Layout layout = Layout::ColumnMajor) const {
+            DataFrame<T> result(m_col_labels.names(), m_row_labels.names(), layout);
+            for_each_column([&](const std::string& col_name, const auto& col) {
+                std::size_t col_idx = get_col_idx(col_name);
+                for (std::size_t row_idx = 0; row_idx < col.size(); row_idx++) {
+                    result[col_idx, row_idx] = static_cast<T>(col[row_idx]);
+                }
+                if (const Mask* valid = col.validity()) { result.set_validity(col_idx, *valid); }
+            });
+            return result;
+        }
+
+      private:
+        TypedDataFrame(LabelIndex col_labels, LabelIndex row_labels, Series<Ts>... columns)
+            : m_col_labels(std::move(col_labels)),
+              m_row_labels(std::move(row_labels)),
+              m_columns(std::move(columns)...) {
+            fix_column_sizes(true);
+        }
+
+        void fix_column_sizes(bool fixed) {
+            std::apply([fixed](auto&... cols) { ((cols.m_fixed_size = fixed), ...); }, m_columns);
+        }
+
+        template<typename Self, typename Fn, std::size_t... Is>
+        static void for_each_column_impl(Self& self, Fn& fn, std::index_sequence<Is...>) {
+            (fn(self.m_col_labels.name(Is), std::get<Is>(self.m_columns)), ...);
+        }
+
+        template<typename Self, typename Fn, std::size_t... Is>
+        static void visit_column_impl(Self& self, std::size_t col_idx, Fn& fn, std::index_sequence<Is...>) {
+            if (col_idx >= sizeof...(Ts)) { throw std::out_of_range("column index out of range"); }
+            ((col_idx == Is ? (fn(std::get<Is>(self.m_columns)), true) : false) || ...);
+        }
+
+        template<typename T, typename Self>
+        static auto column_as(Self& self, std::size_t col_idx) {
+            using series_ptr = std::conditional_t<std::is_const_v<Self>, const Series<T>*, Series<T>*>;
+            series_ptr result = nullptr;
+            self.visit_column(col_idx, [&result](auto& col) {
+                if constexpr (std::is_same_v<typename std::remove_cvref_t<decltype(col)>::data_type, T>) { result = &col; }
+            });
+            if (result == nullptr) { throw std::invalid_argument("Column type mismatch: " + self.m_col_labels.name(col_idx)); }
+            return result;
+        }
+
+        template<std::size_t... Is>
+        void gather_columns(TypedDataFrame& result, const std::vector<std::size_t>& rows, std::index_sequence<Is...>) const {
+            (gather_column(std::get<Is>(m_columns), std::get<Is>(result.m_columns), rows), ...);
+        }
+
+        template<typename T>
+        static void gather_column(const Series<T>& src, Series<T>& dst, const std::vector<std::size_t>& rows) {
+            for (std::size_t row_idx = 0; row_idx < rows.size(); row_idx++) {
+                dst[row_idx] = src[rows[row_idx]];
+            }
+            if (const Mask* src_valid = src.validity()) {
+                Mask valid(rows.size());
+                for (std::size_t row_idx = 0; row_idx < rows.size(); row_idx++) {
+                    valid.set(row_idx, (*src_valid)[rows[row_idx]]);
+                }
+                dst.set_validity(std::move(valid));
+            }
+        }
+
+        LabelIndex                m_col_labels;
+        LabelIndex                m_row_labels;
+        std::tuple<Series<Ts>...> m_columns;
+    };
+
+} // namespace df
+
+#endif // DATA_FRAME_TYPED_H
@@ -0,0 +1,68 @@
+#ifndef ALGO_TESTS_H
+#define ALGO_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+template<typename Policy>
+void expect_buffer_algorithms(Policy policy) {
+    DataFrame<double> df    = create_dataframe<double, 4, 50000>(Layout::ColumnMajor);
+    DataFrame<double> other = create_dataframe<double, 4, 50000>(Layout::ColumnMajor);
+    fill(policy, df, 2.0);
+    fill(policy, other, 3.0);
+    EXPECT_EQ(count_if(policy, df, [](double value) { return value == 2.0; }), df.size());
+
+    transform(policy, df, [](double value) { return value * 2.0; });
+    EXPECT_EQ(df[0], 4.0);
+    EXPECT_EQ(df[df.size() - 1], 4.0);
+
+    zip_transform(policy, df, other, df, [](double lhs, double rhs) { return lhs - rhs; });
+    EXPECT_EQ(count_if(policy, df, [](double value) { return value == 1.0; }), df.size());
+
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = static_cast<double>(i % 10);
+    }
+    replace_if(policy, df, [](double value) { return value > 6.0; }, -1.0);
+    EXPECT_EQ(count_if(policy, df, [](double value) { return value == -1.0; }), 3 * df.size() / 10);
+
+    Series<int> series(100000);
+    Series<int> squares(100000);
+    fill(policy, series, 3);
+    transform(policy, series, squares, [](int value) { return value * value; });
+    EXPECT_EQ(count_if(policy, squares, [](int value) { return value == 9; }), squares.size());
+}
+
+TEST(algo_tests, bufferAlgorithmsUnderEveryPolicy) {
+    expect_buffer_algorithms(execution::seq);
+    expect_buffer_algorithms(execution::par.with_threads(4));
+    expect_buffer_algorithms(execution::par_unseq.with_threads(4));
+
+    Series<double> series{1.0, 5.0, 9.0};
+    replace_if(series, [](double value) { return value > 4.0; }, 0.0);
+    EXPECT_EQ(series[1], 0.0);
+    EXPECT_EQ(count_if(series, [](double value) { return value == 0.0; }), 2);
+}
+
+TEST(algo_tests, forEachColumnAndRow) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<int> df = create_dataframe<int, 8, 20000>(layout);
+        fill_df(df, 1);
+
+        for_each_column(execution::par.with_threads(4), df, [](ColumnView<int> col) { col *= static_cast<int>(col.index() + 1); });
+        const DataFrame<int>&    frame = df;
+        std::vector<std::size_t> row_sums(frame.row_count());
+        for_each_row(execution::par.with_threads(4), frame, [&row_sums](RowView<const int> row) {
+            row_sums[row.index()] = static_cast<std::size_t>(std::accumulate(row.begin(), row.end(), 0));
+        });
+        EXPECT_EQ(std::count(row_sums.begin(), row_sums.end(), std::size_t{36}), frame.row_count());
+
+        std::size_t columns = 0;
+        for_each_column(frame, [&columns](ColumnView<const int>) { columns++; });
+        EXPECT_EQ(columns, 8);
+    }
+}
+
+#endif // ALGO_TESTS_H
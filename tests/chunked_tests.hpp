@@ -0,0 +1,76 @@
+#ifndef CHUNKED_TESTS_H
+#define CHUNKED_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(chunked_tests, appendFillsChunksInBothLayouts) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        ChunkedDataFrame<int> df({"a", "b", "c"}, 4, layout);
+        for (int row_idx = 0; row_idx < 10; row_idx++) {
+            df.append_row("row-" + std::to_string(row_idx), {row_idx, row_idx * 10, -row_idx});
+        }
+        const int* first_chunk = df.chunk(0).d;
+        df.append_rows({"row-10", "row-11", "row-12"}, std::vector<int>{10, 100, -10, 11, 110, -11, 12, 120, -12});
+
+        EXPECT_EQ(df.chunk(0).d, first_chunk);
+        EXPECT_EQ(df.chunk_count(), 4);
+        EXPECT_EQ(df.chunk(3).row_begin, 12);
+        EXPECT_EQ(df.chunk(3).row_count, 1);
+        EXPECT_EQ(df.shape().row_count, 13);
+        EXPECT_EQ((df["b", "row-7"]), 70);
+        EXPECT_EQ((df[2, 12]), -12);
+
+        int expected = 0;
+        for (int value : df.column("b")) {
+            EXPECT_EQ(value, expected * 10);
+            expected++;
+        }
+        EXPECT_EQ(expected, 13);
+
+        DataFrame<int> dense = df.to_dataframe(execution::par, Layout::RowMajor);
+        EXPECT_EQ(dense.shape().row_count, 13);
+        EXPECT_EQ((dense["a", "row-11"]), 11);
+        EXPECT_EQ(dense.get_row_idx("row-4"), 4);
+
+        // the copy holds the filled rows, the last chunk fills up on its own.
+        ChunkedDataFrame<int> copy = df;
+        copy.append_row("row-13", {13, 130, -13});
+        EXPECT_EQ(copy.chunk(3).row_count, 2);
+        EXPECT_EQ((copy["c", "row-12"]), -12);
+        EXPECT_EQ((copy["b", "row-13"]), 130);
+        EXPECT_EQ(df.shape().row_count, 13);
+        EXPECT_EQ(copy.sum(execution::seq)[0], df.sum(execution::seq)[0] + 13);
+    }
+}
+
+TEST(chunked_tests, chunkReductionsMatchDenseFrame) {
+    std::vector<std::string> col_names{"x", "y"};
+    std::vector<std::string> row_names;
+    for (std::size_t row_idx = 0; row_idx < 5000; row_idx++) {
+        row_names.push_back("row-" + std::to_string(row_idx));
+    }
+    ChunkedDataFrame<double> df(execution::par, col_names, row_names, 512);
+    EXPECT_EQ(df.chunk_count(), 10);
+    EXPECT_EQ((df[1, 4999]), 0.0);
+    df.for_each_chunk(execution::par, [](const ChunkView<double>& chunk) {
+        for (std::size_t row_idx = 0; row_idx < chunk.row_count; row_idx++) {
+            double row        = static_cast<double>(chunk.row_begin + row_idx);
+            chunk[0, row_idx] = 0.1 * row;
+            chunk[1, row_idx] = 1000.0 - row;
+        }
+    });
+
+    DataFrame<double> dense = df.to_dataframe();
+    Series<double>    sums  = df.sum(execution::seq);
+    EXPECT_TRUE(sums.is_equal_with(df.sum(execution::par.with_threads(3))));
+    EXPECT_NEAR(sums[0], dense.column(0).sum(), 1e-9);
+    EXPECT_NEAR(df.var(execution::par)[1], dense.column(1).var(), 1e-6);
+    EXPECT_EQ(df.min(execution::par)[1], -3999.0);
+    EXPECT_EQ(df.max(execution::par)[0], 0.1 * 4999.0);
+}
+
+#endif // CHUNKED_TESTS_H
@@ -312,4 +312,69 @@ TEST(col_operators_tests, division_operators) {
     }
 }
 
+TEST(col_view_tests, stridedViewAliasesFrame) {
+    DataFrame<int> df = create_dataframe<int, 3, 3>();
+
+    int values[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = values[i];
+    }
+
+    auto col = df.column(1);
+    EXPECT_EQ(col.stride(), 3);
+    EXPECT_FALSE(col.is_contiguous());
+    EXPECT_EQ(col.data(), &(df[1, 0]));
+    EXPECT_EQ(&col[2], &(df[1, 2]));
+    EXPECT_EQ(col.end() - col.begin(), 3);
+
+    auto copy = col;
+    copy[0]   = 20;
+    EXPECT_EQ((df[1, 0]), 20);
+
+    col = Series<int>{10, 11, 12};
+    EXPECT_EQ((df[1, 0]), 10);
+    EXPECT_EQ((df[1, 1]), 11);
+    EXPECT_EQ((df[1, 2]), 12);
+    EXPECT_EQ(col.max(), 12);
+    EXPECT_EQ(col.min(), 10);
+}
+
+TEST(col_view_tests, columnMajorViewIsContiguous) {
+    DataFrame<int> df = create_dataframe<int, 3, 3>(Layout::ColumnMajor);
+
+    auto col = df.column(2);
+    EXPECT_TRUE(col.is_contiguous());
+    EXPECT_EQ(col.data() + 1, &col[1]);
+}
+
+TEST(col_operators_tests, compound_assignment_operators) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        // 1 2 3
+        // 4 5 6
+        // 7 8 9
+        DataFrame<int> df = create_dataframe<int, 3, 3>(layout);
+        for (std::size_t col_idx = 0; col_idx < 3; col_idx++) {
+            for (std::size_t row_idx = 0; row_idx < 3; row_idx++) {
+                df[col_idx, row_idx] = static_cast<int>((row_idx * 3) + col_idx + 1);
+            }
+        }
+
+        auto col = df.column(0);
+        col += 1;
+        col *= Series<int>{1, 2, 3};
+        col -= df.column(1);
+        ++col;
+        col /= 2;
+        --df.column(2);
+
+        int expected_col[3]   = {0, 3, 8};
+        int expected_third[3] = {2, 5, 8};
+        for (std::size_t row_idx = 0; row_idx < 3; row_idx++) {
+            EXPECT_EQ((df[0, row_idx]), expected_col[row_idx]);
+            EXPECT_EQ((df[2, row_idx]), expected_third[row_idx]);
+        }
+        EXPECT_EQ((df[1, 1]), 5);
+    }
+}
+
 #endif // COLUMN_TESTS_H
@@ -16,7 +16,7 @@ TEST(df_iter_tests, dfIter) {
 
     int value = 0;
     for (auto c : df) {
-        EXPECT_EQ(value, c.value);
+        EXPECT_EQ(value, c);
         value++;
     }
 }
@@ -29,11 +29,11 @@ TEST(df_iter_tests, dfIterModifyValues) {
     }
 
     for (auto& c : df) {
-        c.value = 999;
+        c = 999;
     }
 
     for (auto& c : df) {
-        EXPECT_EQ(999, c.value);
+        EXPECT_EQ(999, c);
     }
 }
 
@@ -48,9 +48,9 @@ TEST(df_iter_tests, dfRowIter) {
     std::size_t value = 0;
     for (auto row_iterator = df.iter_rows(); row_iterator < df.end(); row_iterator++) {
         for (auto& c : row_iterator.current_row()) {
-            EXPECT_EQ(c, &df[idx]);
-            EXPECT_EQ(c->value, df[idx].value);
-            EXPECT_EQ(c->value, value);
+            EXPECT_EQ(&c, &df[idx]);
+            EXPECT_EQ(c, df[idx]);
+            EXPECT_EQ(c, value);
             idx++;
             value++;
         }
@@ -67,15 +67,98 @@ TEST(df_iter_tests, dfColIter) {
     std::size_t idx = 0;
     for (auto col_iterator = df.iter_cols(); col_iterator < df.end(); col_iterator++) {
         idx = col_iterator.current_col_idx();
-        for (auto c : col_iterator.current_col()) {
-            EXPECT_EQ(c, &df[idx]);
-            EXPECT_EQ(c, &df[c->idx.global_idx]);
-            EXPECT_EQ(c->value, df[c->idx.global_idx].value);
+        for (auto& c : col_iterator.current_col()) {
+            EXPECT_EQ(&c, &df[idx]);
+            EXPECT_EQ(df.index_of(idx).col_idx, col_iterator.current_col_idx());
+            EXPECT_EQ(c, df[idx]);
             idx += df.row_size();
         }
     }
 }
 
+TEST(df_layout_tests, dfColumnMajorColIterIsContiguous) {
+    DataFrame<int> df = create_dataframe<int, 4, 6>(Layout::ColumnMajor);
+
+    EXPECT_EQ(df.layout(), Layout::ColumnMajor);
+    EXPECT_EQ(df.col_stride(), 1);
+    EXPECT_EQ(df.row_stride(), df.row_count());
+
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = (long)i;
+    }
+
+    for (auto col_iterator = df.iter_cols(); col_iterator < df.end(); col_iterator++) {
+        std::size_t idx = col_iterator.current_col_idx() * df.col_size();
+        for (auto& c : col_iterator.current_col()) {
+            EXPECT_EQ(&c, &df[idx]);
+            EXPECT_EQ(df.index_of(idx).col_idx, col_iterator.current_col_idx());
+            idx++;
+        }
+    }
+}
+
+TEST(df_layout_tests, dfColumnMajorRowIter) {
+    DataFrame<int> df = create_dataframe<int, 4, 6>(Layout::ColumnMajor);
+
+    for (std::size_t col_idx = 0; col_idx < df.col_count(); col_idx++) {
+        for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+            df[col_idx, row_idx] = static_cast<int>((row_idx * df.col_count()) + col_idx);
+        }
+    }
+
+    int value = 0;
+    for (auto row_iterator = df.iter_rows(); row_iterator < df.end(); row_iterator++) {
+        EXPECT_EQ(row_iterator.current_row().index(), row_iterator.current_row_idx());
+        for (auto& c : row_iterator.current_row()) {
+            EXPECT_EQ(c, value);
+            EXPECT_EQ(df.index_of(static_cast<std::size_t>(&c - &df[0])).row_idx, row_iterator.current_row_idx());
+            value++;
+        }
+    }
+    EXPECT_EQ(value, static_cast<int>(df.size()));
+}
+
+TEST(df_layout_tests, dfLayoutsAgreeOnNamedAccess) {
+    DataFrame<int> row_major = create_dataframe<int, 3, 5>();
+    DataFrame<int> col_major = create_dataframe<int, 3, 5>(Layout::ColumnMajor);
+
+    for (std::size_t col_idx = 0; col_idx < row_major.col_count(); col_idx++) {
+        for (std::size_t row_idx = 0; row_idx < row_major.row_count(); row_idx++) {
+            row_major[col_idx, row_idx] = static_cast<int>((col_idx * 10) + row_idx);
+            col_major[col_idx, row_idx] = static_cast<int>((col_idx * 10) + row_idx);
+        }
+    }
+
+    const Cell<int> col_major_cell = col_major.cell(1, 3);
+    EXPECT_EQ((row_major["col-2", "row-4"]), (col_major["col-2", "row-4"]));
+    EXPECT_EQ(col_major_cell.value, (col_major["col-2", "row-4"]));
+    EXPECT_EQ(col_major_cell.idx.col_name, "col-2");
+    EXPECT_EQ(col_major_cell.idx.row_name, "row-4");
+    EXPECT_TRUE((row_major["col-3"] == col_major["col-3"].to_series()).eval().is_equal_with(Series<bool>{true, true, true, true, true}));
+
+    auto row_major_sorted = row_major.sort("col-1", true);
+    auto col_major_sorted = col_major.sort("col-1", true);
+    for (std::size_t i = 0; i < row_major.row_count(); i++) {
+        EXPECT_EQ(row_major_sorted[i].name(), col_major_sorted[i].name());
+    }
+}
+
+TEST(df_value_storage_tests, dfCellHoldsValueOnly) {
+    DataFrame<double> df = create_dataframe<double, 3, 4>();
+
+    EXPECT_EQ(sizeof(*df.begin()), sizeof(double));
+    EXPECT_EQ(&df[df.size() - 1] - &df[0], static_cast<std::ptrdiff_t>(df.size() - 1));
+
+    Index idx = df.index_of(7);
+    EXPECT_EQ(idx.global_idx, 7);
+    EXPECT_EQ(idx.col_idx, 1);
+    EXPECT_EQ(idx.row_idx, 2);
+    EXPECT_EQ(idx.col_name, "col-2");
+    EXPECT_EQ(idx.row_name, "row-3");
+    EXPECT_EQ(df.column(1).name(), "col-2");
+    EXPECT_EQ(df.row(2).name(), "row-3");
+}
+
 TEST(df_copy_tests, dfCopyShapeEquality) {
     DataFrame<int> df_orig = create_dataframe<int, 10, 10>();
     DataFrame<int> df_copy = df_orig.copy();
@@ -130,15 +213,149 @@ TEST(df_sort, dfRowsAscendingSort) {
     std::array<int, 10> sorted_values = {28, 25, 22, 19, 16, 13, 10, 7, 4, 1};
 
     for (const auto& row : sorted_rows) {
-        for (auto c : row) {
-            EXPECT_EQ(c, &df[c->idx.global_idx]);
-            EXPECT_EQ(c->value, df[c->idx.global_idx].value);
+        std::size_t col = 0;
+        for (auto& c : row) {
+            EXPECT_EQ(&c, (&df[col, row.index()]));
+            col++;
         }
     }
 
     for (std::size_t i = 0; i < df.row_count(); i++) {
-        EXPECT_EQ(sorted_rows[i][col_idx]->value, sorted_values[i]);
+        EXPECT_EQ(sorted_rows[i][col_idx], sorted_values[i]);
+    }
+}
+
+TEST(df_sort, dfRowGroupHoldsRowIndices) {
+    DataFrame<int> df = create_dataframe<int, 3, 4>();
+
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = static_cast<int>(i);
+    }
+
+    auto rows = df.sort("col-1", false);
+    EXPECT_EQ(rows.row_indices(), (std::vector<std::size_t>{3, 2, 1, 0}));
+    EXPECT_EQ(rows[0].index(), 3);
+    EXPECT_TRUE(rows[0].is_contiguous());
+    EXPECT_EQ(rows[0].data(), &(df[0, 3]));
+    EXPECT_EQ(rows.end() - rows.begin(), 4);
+
+    rows[1]["col-2"] = 100;
+    EXPECT_EQ((df[1, 2]), 100);
+
+    DataFrame<int> sorted{rows};
+    EXPECT_EQ((sorted[0, 0]), 9);
+    EXPECT_EQ(sorted.get_row_name(0), "row-4");
+}
+
+TEST(df_copy_tests, dfMoveTakesBuffer) {
+    static_assert(std::is_nothrow_move_constructible_v<DataFrame<int>>);
+    static_assert(std::is_nothrow_move_assignable_v<DataFrame<int>>);
+    static_assert(std::is_nothrow_move_constructible_v<Cell<int>>);
+    static_assert(std::is_nothrow_move_constructible_v<Index>);
+
+    DataFrame<int> df = create_dataframe<int, 3, 4>(Layout::ColumnMajor);
+    df[1, 2]          = 42;
+    const int* buffer = &df[0];
+
+    DataFrame<int> moved{std::move(df)};
+    EXPECT_TRUE(df.is_null());
+    EXPECT_EQ(&moved[0], buffer);
+    EXPECT_EQ(moved.layout(), Layout::ColumnMajor);
+    EXPECT_EQ((moved["col-2", "row-3"]), 42);
+    EXPECT_EQ(moved.column(1).name(), "col-2");
+
+    DataFrame<int> other = create_dataframe<int, 1, 1>();
+    other                = std::move(moved);
+    EXPECT_TRUE(moved.is_null());
+    EXPECT_EQ(&other[0], buffer);
+    EXPECT_EQ(other.shape().row_count, 4);
+    EXPECT_EQ(other.get_row_idx("row-4"), 3);
+}
+
+TEST(df_operators_tests, dfCompoundAssignment) {
+    DataFrame<double> row_major    = create_dataframe<double, 3, 5>();
+    DataFrame<double> column_major = create_dataframe<double, 3, 5>(Layout::ColumnMajor);
+    for (std::size_t col_idx = 0; col_idx < 3; col_idx++) {
+        for (std::size_t row_idx = 0; row_idx < 5; row_idx++) {
+            row_major[col_idx, row_idx]    = static_cast<double>(col_idx + row_idx);
+            column_major[col_idx, row_idx] = static_cast<double>(col_idx * row_idx);
+        }
+    }
+
+    DataFrame<double> result{row_major};
+    result *= 2.0;
+    result += column_major;
+    ++result;
+    result -= row_major;
+    result /= 0.5;
+
+    for (std::size_t col_idx = 0; col_idx < 3; col_idx++) {
+        for (std::size_t row_idx = 0; row_idx < 5; row_idx++) {
+            double expected = (static_cast<double>(col_idx + row_idx) + static_cast<double>(col_idx * row_idx) + 1.0) / 0.5;
+            EXPECT_EQ((result[col_idx, row_idx]), expected);
+        }
+    }
+}
+
+TEST(df_growth_tests, dfAppendAndDropInBothLayouts) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<int> df = create_dataframe<int, 2, 3>(layout);
+        for (std::size_t col_idx = 0; col_idx < 2; col_idx++) {
+            for (std::size_t row_idx = 0; row_idx < 3; row_idx++) {
+                df[col_idx, row_idx] = static_cast<int>((col_idx * 10) + row_idx);
+            }
+        }
+
+        df.append_row("row-4", {3, 13});
+        df.append_rows({"row-5", "row-6"}, std::vector<int>{4, 14, 5, 15});
+        df.append_column("col-3", {20, 21, 22, 23, 24, 25});
+        EXPECT_EQ(df.shape().col_count, 3);
+        EXPECT_EQ(df.shape().row_count, 6);
+        EXPECT_EQ(df.get_row_idx("row-6"), 5);
+        for (std::size_t col_idx = 0; col_idx < 3; col_idx++) {
+            for (std::size_t row_idx = 0; row_idx < 6; row_idx++) {
+                EXPECT_EQ((df[col_idx, row_idx]), static_cast<int>((col_idx * 10) + row_idx));
+            }
+        }
+
+        df.drop_rows(std::vector<std::size_t>{0, 4});
+        df.drop_columns(std::vector<std::string>{"col-2"});
+        EXPECT_EQ(df.shape().col_count, 2);
+        EXPECT_EQ(df.shape().row_count, 4);
+        EXPECT_EQ(df.get_col_idx("col-3"), 1);
+        EXPECT_EQ(df.get_row_idx("row-6"), 3);
+        EXPECT_FALSE(df.row_labels().contains("row-1"));
+        EXPECT_EQ((df["col-3", "row-4"]), 23);
+        EXPECT_EQ((df["col-1", "row-6"]), 5);
+        EXPECT_EQ(df.column(1).sum(), 21 + 22 + 23 + 25);
+
+        df.shrink_to_fit();
+        EXPECT_EQ(df.capacity(), df.size());
+    }
+}
+
+TEST(df_growth_tests, dfRowAppendIsAmortized) {
+    DataFrame<double> df            = create_dataframe<double, 4, 0>();
+    std::size_t       reallocations = 0;
+    std::size_t       capacity      = df.capacity();
+    for (std::size_t row_idx = 0; row_idx < 1000; row_idx++) {
+        double value = static_cast<double>(row_idx);
+        df.append_row("row-" + std::to_string(row_idx + 1), {value, value, value, value});
+        if (df.capacity() != capacity) {
+            reallocations++;
+            capacity = df.capacity();
+        }
+    }
+    EXPECT_EQ(df.shape().row_count, 1000);
+    EXPECT_LE(reallocations, 12);
+    EXPECT_EQ(df.column(2).sum(), 999.0 * 1000.0 / 2.0);
+
+    df.reserve(df.size() + 400);
+    const double* buffer = df.data();
+    for (std::size_t row_idx = 1000; row_idx < 1100; row_idx++) {
+        df.append_row("row-" + std::to_string(row_idx + 1), {0.0, 0.0, 0.0, 0.0});
     }
+    EXPECT_EQ(df.data(), buffer);
 }
 
 #endif // DATA_FRAME_TESTS_H
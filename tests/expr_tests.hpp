@@ -0,0 +1,56 @@
+#ifndef EXPR_TESTS_H
+#define EXPR_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(expr_tests, fusedFormulaMatchesElementWise) {
+    Series<double> a{1, 2, 3, 4};
+    Series<double> b{2, 2, 2, 2};
+    Series<double> c{0.5, 0.5, 0.5, 0.5};
+    Series<double> d{1, 0, 1, 0};
+
+    auto expr = a * b + c - d;
+    EXPECT_EQ(expr.size(), 4);
+    EXPECT_EQ(expr[3], 8.5);
+
+    Series<double> result = expr;
+    for (std::size_t i = 0; i < a.size(); i++) {
+        EXPECT_EQ(result[i], (a[i] * b[i]) + c[i] - d[i]);
+    }
+
+    Series<bool> mask = (a * 2.0 > b + 3.0).eval();
+    EXPECT_FALSE(mask[1]);
+    EXPECT_TRUE(mask[2]);
+
+    const double* buffer = a.data();
+    a                    = a * a - 1.0;
+    EXPECT_EQ(a.data(), buffer);
+    EXPECT_EQ(a[3], 15.0);
+}
+
+TEST(expr_tests, mixesColumnsSeriesAndScalars) {
+    DataFrame<int> df = create_dataframe<int, 3, 3>(Layout::ColumnMajor);
+
+    int values[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = values[i];
+    }
+
+    // rvalue series operands are owned by the expression
+    auto expr = df["col-1"] * 10 + df["col-2"].to_series() - 1;
+
+    df["col-3"] = expr;
+    EXPECT_EQ((df[2, 0]), 13);
+    EXPECT_EQ((df[2, 1]), 24);
+    EXPECT_EQ((df[2, 2]), 35);
+
+    Series<bool> above = 20 < df.column(2);
+    EXPECT_FALSE(above[0]);
+    EXPECT_TRUE(above[1]);
+}
+
+#endif // EXPR_TESTS_H
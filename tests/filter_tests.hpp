@@ -0,0 +1,84 @@
+#ifndef FILTER_TESTS_H
+#define FILTER_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(filter_tests, maskSelectsRowsWithoutCopy) {
+    DataFrame<double> df = create_dataframe<double, 2, 300>(Layout::ColumnMajor);
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<double>(row_idx % 10);
+        df[1, row_idx] = static_cast<double>(row_idx);
+    }
+
+    for_each_simd_level([&] {
+        auto rows = df.filter(df["col-1"] > 6.0);
+        ASSERT_EQ(rows.size(), 90);
+        for (std::size_t i = 0; i < rows.size(); i++) {
+            std::size_t row_idx = rows.row_index(i);
+            ASSERT_EQ(row_idx, ((i / 3) * 10) + 7 + (i % 3));
+        }
+    });
+
+    // the group refers to the frame cells.
+    auto rows = df.filter((df["col-1"] == 0.0) & (df["col-2"] < 100.0));
+    ASSERT_EQ(rows.size(), 10);
+    rows[1]["col-2"] = -1.0;
+    EXPECT_EQ((df[1, 10]), -1.0);
+
+    DataFrame<double> compact = rows.to_dataframe(Layout::ColumnMajor);
+    EXPECT_EQ(compact.row_count(), 10);
+    EXPECT_EQ(compact.get_row_name(1), "row-11");
+    EXPECT_EQ((compact[1, 1]), -1.0);
+    EXPECT_EQ(compact.column(0).max(), 0.0);
+
+    EXPECT_EQ(df.filter(Mask(300)).size(), 0);
+    EXPECT_EQ(df.filter(~Mask(300)).size(), 300);
+}
+
+TEST(filter_tests, rowGroupFilterByPredicateAndMask) {
+    DataFrame<int> df = create_dataframe<int, 2, 20>();
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<int>(row_idx);
+        df[1, row_idx] = static_cast<int>(row_idx % 4);
+    }
+
+    auto sorted = df.sort("col-1", false);
+    auto even   = sorted.filter([](const auto& row) { return row[0] % 2 == 0; });
+    EXPECT_EQ(even.row_indices(), (std::vector<std::size_t>{18, 16, 14, 12, 10, 8, 6, 4, 2, 0}));
+
+    Mask first_two{true, true, false, false, false, false, false, false, false, false};
+    EXPECT_EQ(even.filter(first_two).row_indices(), (std::vector<std::size_t>{18, 16}));
+
+    auto zeros = df.rows().filter([](const auto& row) { return row["col-2"] == 0; }).to_dataframe();
+    EXPECT_EQ(zeros.row_count(), 5);
+    EXPECT_EQ((zeros[0, 4]), 16);
+}
+
+TEST(filter_tests, constFrameFilterMaterializes) {
+    DataFrame<double> df = create_dataframe<double, 2, 6>(Layout::RowMajor);
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<double>(row_idx);
+        df[1, row_idx] = static_cast<double>(row_idx) * 10.0;
+    }
+    df.set_null(1, 4);
+    const DataFrame<double>& const_df = df;
+
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<double> kept = const_df.filter(const_df["col-1"] > 2.0).to_dataframe(layout);
+        EXPECT_EQ(kept.layout(), layout);
+        EXPECT_EQ(kept.shape().row_count, 3);
+        EXPECT_EQ(kept.get_row_idx("row-4"), 0);
+        EXPECT_DOUBLE_EQ((kept["col-2", "row-6"]), 50.0);
+        EXPECT_FALSE(kept.is_valid("col-2", "row-5"));
+    }
+
+    DataFrame<double> taken{const_df.take({5, 0}), Layout::ColumnMajor};
+    EXPECT_EQ(taken.row_labels().name(0), "row-6");
+    EXPECT_DOUBLE_EQ((taken[0, 1]), 0.0);
+}
+
+#endif // FILTER_TESTS_H
@@ -0,0 +1,63 @@
+#ifndef LABEL_INDEX_TESTS_H
+#define LABEL_INDEX_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(label_index_tests, lookupBothWays) {
+    std::vector<std::string> names{};
+    for (std::size_t i = 0; i < 1000; i++) {
+        names.push_back("label-" + std::to_string(i));
+    }
+
+    LabelIndex labels(names);
+
+    EXPECT_EQ(labels.size(), names.size());
+    EXPECT_EQ(labels.max_name_size(), std::string("label-999").size());
+    for (std::size_t i = 0; i < names.size(); i++) {
+        EXPECT_EQ(labels.find(names[i]), i);
+        EXPECT_EQ(labels.name(i), names[i]);
+    }
+
+    std::string_view name = "label-42";
+    EXPECT_EQ(labels.at(name), 42);
+    EXPECT_TRUE(labels.contains("label-0"));
+    EXPECT_FALSE(labels.contains("label-1000"));
+    EXPECT_EQ(labels.find("missing"), LabelIndex::npos);
+    EXPECT_THROW(labels.at("missing"), std::out_of_range);
+}
+
+TEST(label_index_tests, duplicateNameKeepsFirstPosition) {
+    LabelIndex labels{};
+    labels.push_back("a");
+    labels.push_back("b");
+    labels.push_back("a");
+
+    EXPECT_EQ(labels.size(), 3);
+    EXPECT_EQ(labels.find("a"), 0);
+    EXPECT_EQ(labels.name(2), "a");
+}
+
+TEST(label_index_tests, dfNameAccessors) {
+    DataFrame<int> df = create_dataframe<int, 4, 5>();
+
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = static_cast<int>(i);
+    }
+
+    EXPECT_EQ(df.get_col_name(2), "col-3");
+    EXPECT_EQ(df.get_row_name(4), "row-5");
+    EXPECT_EQ(df.get_col_idx("col-4"), 3);
+    EXPECT_EQ(df.get_row_idx("row-1"), 0);
+    EXPECT_EQ((df["col-3", "row-2"]), 6);
+    EXPECT_EQ(df["col-3"]["row-2"], 6);
+    EXPECT_EQ(df.row("row-2")["col-3"], 6);
+    EXPECT_EQ(df.row(1).column_index_of("col-3"), 2);
+    EXPECT_THROW((df["col-3", "row-9"]), std::out_of_range);
+    EXPECT_THROW(df.column("col-9"), std::out_of_range);
+}
+
+#endif // LABEL_INDEX_TESTS_H
@@ -1,8 +1,21 @@
 #include <gtest/gtest.h>
 
+#include "algo_tests.hpp"
+#include "chunked_tests.hpp"
 #include "column_tests.hpp"
 #include "df_tests.hpp"
+#include "expr_tests.hpp"
+#include "filter_tests.hpp"
+#include "label_index_tests.hpp"
+#include "mask_tests.hpp"
+#include "mmap_tests.hpp"
+#include "null_tests.hpp"
+#include "parallel_tests.hpp"
+#include "reduce_tests.hpp"
 #include "series_tests.hpp"
+#include "simd_tests.hpp"
+#include "sort_tests.hpp"
+#include "typed_tests.hpp"
 
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,65 @@
+#ifndef MASK_TESTS_H
+#define MASK_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(mask_tests, bitwiseOperatorsAndCounts) {
+    Mask a{true, false, true, true, false};
+    Mask b{true, true, false, true, false};
+
+    EXPECT_EQ(a & b, (Mask{true, false, false, true, false}));
+    EXPECT_EQ(a | b, (Mask{true, true, true, true, false}));
+    EXPECT_EQ(a ^ b, (Mask{false, true, true, false, false}));
+    EXPECT_EQ(~a, (Mask{false, true, false, false, true}));
+
+    EXPECT_EQ(a.count(), 3);
+    EXPECT_TRUE(a.any());
+    EXPECT_FALSE(a.all());
+    EXPECT_TRUE(Mask(5).none());
+
+    // ~ must not set the bits past size().
+    Mask full = ~Mask(130);
+    EXPECT_EQ(full.word_count(), 3);
+    EXPECT_EQ(full.count(), 130);
+    EXPECT_TRUE(full.all());
+    EXPECT_THROW(full.at(130), std::out_of_range);
+}
+
+TEST(mask_tests, comparisonsWriteBitsAtEveryLevel) {
+    constexpr std::size_t n = 203;
+
+    DataFrame<double> df = create_dataframe<double, 2, n>(Layout::ColumnMajor);
+    for (std::size_t row_idx = 0; row_idx < n; row_idx++) {
+        df[0, row_idx] = static_cast<double>((row_idx * 37) % 101);
+        df[1, row_idx] = static_cast<double>((row_idx * 11) % 97);
+    }
+
+    for_each_simd_level([&] {
+        Mask greater = df.column(0) > 50.0;
+        Mask less    = df.column(0) < df.column(1);
+        Mask both    = (df.column(0) > 50.0) & (df.column(0) < df.column(1));
+        ASSERT_EQ(greater.size(), n);
+        for (std::size_t row_idx = 0; row_idx < n; row_idx++) {
+            ASSERT_EQ(greater[row_idx], (df[0, row_idx]) > 50.0);
+            ASSERT_EQ(less[row_idx], (df[0, row_idx]) < (df[1, row_idx]));
+            ASSERT_EQ(both[row_idx], greater[row_idx] && less[row_idx]);
+        }
+    });
+
+    // strided columns and nested expressions take the element loop.
+    DataFrame<int> row_major = create_dataframe<int, 2, 70>();
+    for (std::size_t i = 0; i < row_major.size(); i++) {
+        row_major[i] = static_cast<int>((i * 7) % 23);
+    }
+    Mask           odd       = row_major.column(0) * 2 > row_major.column(1);
+    for (std::size_t row_idx = 0; row_idx < 70; row_idx++) {
+        EXPECT_EQ(odd[row_idx], (row_major[0, row_idx]) * 2 > (row_major[1, row_idx]));
+    }
+    EXPECT_EQ(Mask(odd.to_series()), odd);
+}
+
+#endif // MASK_TESTS_H
@@ -0,0 +1,148 @@
+#ifndef MMAP_TESTS_H
+#define MMAP_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+#if !defined(_WIN32)
+
+TEST(mmap_tests, mappedFrameReadsAndWritesTheFile) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "df_mmap_tests.dfm";
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<double> df = create_dataframe<double, 3, 100>(layout);
+        for (std::size_t i = 0; i < df.size(); i++) {
+            df[i] = static_cast<double>(i) * 0.5;
+        }
+        write_mapped_file(df, path);
+
+        {
+            DataFrame<double> mapped = open_mapped_file<double>(path, MapMode::ReadOnly, MapAdvice::Sequential);
+            EXPECT_EQ(mapped.layout(), layout);
+            EXPECT_EQ(mapped.shape().row_count, 100);
+            EXPECT_EQ(mapped.get_row_idx("row-42"), 41);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) % mapped_values_align, 0);
+            EXPECT_EQ((mapped["col-2", "row-7"]), (df["col-2", "row-7"]));
+            EXPECT_EQ(mapped.sum()[2], df.sum()[2]);
+        }
+
+        {
+            DataFrame<double> mapped = open_mapped_file<double>(path, MapMode::ReadWrite, MapAdvice::Random);
+            mapped["col-3", "row-100"] = -1.0;
+            DataFrame<double> moved    = std::move(mapped);
+            moved["col-1", "row-1"]    = 42.0;
+        }
+
+        DataFrame<double> reopened = open_mapped_file<double>(path);
+        EXPECT_EQ((reopened["col-3", "row-100"]), -1.0);
+        EXPECT_EQ((reopened["col-1", "row-1"]), 42.0);
+        EXPECT_EQ((reopened["col-1", "row-2"]), (df["col-1", "row-2"]));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(mmap_tests, mappedFrameDetachesOnGrowthAndRejectsBadFiles) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "df_mmap_tests_growth.dfm";
+    DataFrame<int>        df   = create_dataframe<int, 2, 3>();
+    fill(df, 7);
+    write_mapped_file(df, path);
+
+    DataFrame<int> mapped = open_mapped_file<int>(path, MapMode::ReadWrite);
+    mapped.append_row("row-4", {1, 2});
+    mapped["col-1", "row-1"] = 0;
+    EXPECT_EQ(open_mapped_file<int>(path).shape().row_count, 3);
+    EXPECT_EQ((open_mapped_file<int>(path)["col-1", "row-1"]), 7);
+
+    EXPECT_THROW(open_mapped_file<double>(path), std::runtime_error);
+    EXPECT_THROW(open_mapped_file<int>(path.string() + ".missing"), std::system_error);
+    std::ofstream(path, std::ios::trunc) << "not a frame";
+    EXPECT_THROW(open_mapped_file<int>(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(mmap_tests, mappedFrameDetachesOnDropAndCopyAssign) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "df_mmap_tests_drop.dfm";
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<int> df = create_dataframe<int, 2, 3>(layout);
+        for (std::size_t col_idx = 0; col_idx < 2; col_idx++) {
+            for (std::size_t row_idx = 0; row_idx < 3; row_idx++) {
+                df[col_idx, row_idx] = static_cast<int>((col_idx * 10) + row_idx);
+            }
+        }
+        write_mapped_file(df, path);
+        DataFrame<int> doubled = df;
+        doubled += df;
+
+        for (MapMode mode : {MapMode::ReadOnly, MapMode::ReadWrite}) {
+            DataFrame<int> rows = open_mapped_file<int>(path, mode);
+            rows.drop_rows(std::vector<std::string>{"row-1"});
+            EXPECT_EQ(rows.shape().row_count, 2);
+            EXPECT_EQ((rows["col-1", "row-2"]), 1);
+            EXPECT_EQ((rows["col-2", "row-3"]), 12);
+
+            DataFrame<int> cols = open_mapped_file<int>(path, mode);
+            cols.drop_columns(std::vector<std::string>{"col-1"});
+            EXPECT_EQ(cols.shape().col_count, 1);
+            EXPECT_EQ((cols["col-2", "row-1"]), 10);
+
+            DataFrame<int> assigned = open_mapped_file<int>(path, mode);
+            assigned                = doubled;
+            EXPECT_EQ((assigned["col-2", "row-3"]), 24);
+        }
+
+        // the file keeps its shape and values.
+        DataFrame<int> reopened = open_mapped_file<int>(path);
+        EXPECT_EQ(reopened.shape().row_count, 3);
+        EXPECT_EQ(reopened.shape().col_count, 2);
+        for (std::size_t idx = 0; idx < df.size(); idx++) {
+            EXPECT_EQ(reopened[idx], df[idx]);
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(mmap_tests, mappedFileRejectsCorruptHeaders) {
+    std::filesystem::path   path = std::filesystem::temp_directory_path() / "df_mmap_tests_header.dfm";
+    DataFrame<std::int64_t> df   = create_dataframe<std::int64_t, 2, 3>();
+    fill(df, std::int64_t{5});
+
+    // overwrites a header field of the file.
+    auto patch = [&path](std::size_t offset, auto value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    write_mapped_file(df, path);
+    EXPECT_EQ((open_mapped_file<std::int64_t>(path)["col-2", "row-3"]), 5);
+    EXPECT_THROW(open_mapped_file<double>(path), std::runtime_error);
+    EXPECT_THROW(open_mapped_file<std::uint64_t>(path), std::runtime_error);
+
+    patch(offsetof(MappedFileHeader, layout), std::uint32_t{7});
+    EXPECT_THROW(open_mapped_file<std::int64_t>(path), std::runtime_error);
+
+    // 2^62 columns * 2^62 rows * 8 bytes wraps to 0 in 64 bits.
+    write_mapped_file(df, path);
+    patch(offsetof(MappedFileHeader, col_count), std::uint64_t{1} << 62);
+    patch(offsetof(MappedFileHeader, row_count), std::uint64_t{1} << 62);
+    patch(offsetof(MappedFileHeader, values_size), std::uint64_t{0});
+    EXPECT_THROW(open_mapped_file<std::int64_t>(path), std::runtime_error);
+
+    // no values, but more labels than the label bytes can hold.
+    write_mapped_file(df, path);
+    patch(offsetof(MappedFileHeader, col_count), std::uint64_t{0});
+    patch(offsetof(MappedFileHeader, row_count), std::uint64_t{1} << 40);
+    patch(offsetof(MappedFileHeader, values_size), std::uint64_t{0});
+    EXPECT_THROW(open_mapped_file<std::int64_t>(path), std::runtime_error);
+
+    write_mapped_file(df, path);
+    patch(offsetof(MappedFileHeader, values_offset), std::numeric_limits<std::uint64_t>::max() - 7);
+    EXPECT_THROW(open_mapped_file<std::int64_t>(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+#endif
+
+#endif // MMAP_TESTS_H
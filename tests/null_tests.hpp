@@ -0,0 +1,133 @@
+#ifndef NULL_TESTS_H
+#define NULL_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(null_tests, seriesReductionsSkipNulls) {
+    constexpr std::size_t n = 203;
+
+    Series<double>      values(n);
+    std::vector<double> dense;
+    for (std::size_t i = 0; i < n; i++) {
+        values[i] = static_cast<double>(i);
+    }
+    EXPECT_FALSE(values.has_nulls());
+    EXPECT_EQ(values.validity(), nullptr);
+
+    // nulls hold a value that would win every reduction.
+    for (std::size_t i = 0; i < n; i++) {
+        if (i % 3 == 0 || i == n - 1) {
+            values[i] = 1e9;
+            values.set_null(i);
+        } else {
+            dense.push_back(values[i]);
+        }
+    }
+    std::size_t    valid_count = dense.size();
+    Series<double> expected(valid_count);
+    std::copy(dense.begin(), dense.end(), expected.data());
+
+    EXPECT_TRUE(values.has_nulls());
+    EXPECT_EQ(values.null_count(), n - valid_count);
+    EXPECT_FALSE(values.is_valid(0));
+    EXPECT_TRUE(values.is_valid(1));
+
+    for_each_simd_level([&] {
+        EXPECT_DOUBLE_EQ(values.sum(), expected.sum());
+        EXPECT_DOUBLE_EQ(values.mean(), expected.mean());
+        EXPECT_DOUBLE_EQ(values.var(), expected.var());
+        EXPECT_DOUBLE_EQ(values.max(), expected.max());
+        EXPECT_DOUBLE_EQ(values.min(), expected.min());
+        EXPECT_DOUBLE_EQ(values.sum(execution::par), expected.sum());
+    });
+
+    // element-wise results are null where either operand is.
+    Series<double> other(n);
+    std::fill(other.data(), other.data() + n, 1.0);
+    other.set_null(1);
+    Series<double> sum = values + other * 2.0;
+    EXPECT_EQ(sum.null_count(), values.null_count() + 1);
+    EXPECT_FALSE(sum.is_valid(1));
+    EXPECT_EQ(sum.is_valid(), values.is_valid() & other.is_valid());
+
+    values.clear_validity();
+    EXPECT_EQ(values.validity(), nullptr);
+    EXPECT_DOUBLE_EQ(values.max(), 1e9);
+}
+
+TEST(null_tests, dfColumnNullsInReductionsAndSorts) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<double> df = create_dataframe<double, 2, 6>(layout);
+        for (std::size_t row_idx = 0; row_idx < 6; row_idx++) {
+            df[0, row_idx] = static_cast<double>(row_idx);
+            df[1, row_idx] = static_cast<double>(10 - row_idx);
+        }
+        EXPECT_FALSE(df.has_nulls());
+
+        df.set_null("col-1", "row-2");
+        df.set_null(0, 4);
+        EXPECT_TRUE(df.has_nulls());
+        EXPECT_FALSE(df.is_valid(0, 1));
+        EXPECT_TRUE(df.is_valid(1, 1));
+        EXPECT_EQ(df.validity(1), nullptr);
+        EXPECT_EQ(df.null_count()[0], 2);
+        EXPECT_EQ(df.null_count()[1], 0);
+
+        EXPECT_DOUBLE_EQ(df.column(0).sum(), 0.0 + 2.0 + 3.0 + 5.0);
+        EXPECT_DOUBLE_EQ(df.sum(execution::par)[0], 10.0);
+        EXPECT_DOUBLE_EQ(df.sum(execution::par)[1], 45.0);
+        EXPECT_DOUBLE_EQ(df.max(execution::seq)[0], 5.0);
+        EXPECT_DOUBLE_EQ((df.describe()[0, 0]), 4.0);
+
+        EXPECT_EQ(df.argsort("col-1", true), (std::vector<std::size_t>{0, 2, 3, 5, 1, 4}));
+        EXPECT_EQ(df.argsort("col-1", false, NullOrder::First), (std::vector<std::size_t>{1, 4, 5, 3, 2, 0}));
+
+        // the bitmap follows the rows into a sorted copy.
+        DataFrame<double> sorted{df.sort("col-1", true, NullOrder::First), layout};
+        EXPECT_FALSE(sorted.is_valid(0, 0));
+        EXPECT_FALSE(sorted.is_valid(0, 1));
+        EXPECT_TRUE(sorted.is_valid(0, 2));
+        EXPECT_EQ(sorted.row_labels().name(0), "row-2");
+        EXPECT_DOUBLE_EQ((sorted[1, 2]), 10.0);
+
+        // an expression assigned to a column carries the nulls of its operands.
+        df.column(1) = df.column(0) + df.column(1);
+        EXPECT_EQ(df.column(1).null_count(), 2);
+        EXPECT_FALSE(df.is_valid(1, 4));
+    }
+}
+
+TEST(null_tests, dfValidityFollowsGrowthAndCopies) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<int> df = create_dataframe<int, 2, 3>(layout);
+        df.set_null(1, 0);
+
+        df.append_row("row-4", {3, 13});
+        df.append_column("col-3", {20, 21, 22, 23});
+        EXPECT_EQ(df.column(1).null_count(), 1);
+        EXPECT_TRUE(df.is_valid(1, 3));
+        EXPECT_EQ(df.validity(2), nullptr);
+
+        df.set_null("col-3", "row-4");
+        DataFrame<int> copy = df;
+        df.drop_rows(std::vector<std::size_t>{1});
+        df.drop_columns(std::vector<std::string>{"col-1"});
+        ASSERT_EQ(df.shape().col_count, 2);
+        EXPECT_FALSE(df.is_valid("col-2", "row-1"));
+        EXPECT_FALSE(df.is_valid("col-3", "row-4"));
+        EXPECT_EQ(df.null_count()[0], 1);
+        EXPECT_EQ(df.null_count()[1], 1);
+
+        EXPECT_FALSE(copy.is_valid(2, 3));
+        DataFrame<int> moved = std::move(copy);
+        EXPECT_FALSE(moved.is_valid(1, 0));
+        moved.set_valid(1, 0);
+        EXPECT_TRUE(moved.is_valid(1, 0));
+    }
+}
+
+#endif // NULL_TESTS_H
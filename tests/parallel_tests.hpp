@@ -0,0 +1,81 @@
+#ifndef PARALLEL_TESTS_H
+#define PARALLEL_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(parallel_tests, parallelForCoversRangeOnce) {
+    std::vector<int> hits(1000, 0);
+    parallel_for(
+    0,
+    hits.size(),
+    [&hits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            hits[i]++;
+        }
+    },
+    8);
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 1000);
+}
+
+TEST(parallel_tests, parallelForRethrows) {
+    EXPECT_THROW(parallel_for(
+                 0,
+                 100,
+                 [](std::size_t begin, std::size_t) {
+                     if (begin > 0) { throw std::runtime_error("chunk failed"); }
+                 },
+                 4),
+                 std::runtime_error);
+}
+
+TEST(parallel_tests, threadPoolRunsEveryTask) {
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(3);
+        EXPECT_EQ(pool.worker_count(), 3);
+        for (int i = 0; i < 1000; i++) {
+            pool.submit([&done] { done++; });
+        }
+        while (pool.run_pending_task()) {}
+    } // the destructor drains the queues before it returns
+    EXPECT_EQ(done.load(), 1000);
+}
+
+TEST(parallel_tests, nestedParallelFor) {
+    std::vector<int> hits(64 * 64, 0);
+    parallel_for(
+    0,
+    64,
+    [&hits](std::size_t begin, std::size_t end) {
+        for (std::size_t outer = begin; outer < end; outer++) {
+            parallel_for(
+            0,
+            64,
+            [&hits, outer](std::size_t inner_begin, std::size_t inner_end) {
+                for (std::size_t inner = inner_begin; inner < inner_end; inner++) {
+                    hits[(outer * 64) + inner]++;
+                }
+            },
+            4);
+        }
+    },
+    4);
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 64 * 64);
+}
+
+TEST(parallel_tests, copyWithPolicy) {
+    DataFrame<int> df = create_dataframe<int, 4, 50000>(Layout::ColumnMajor);
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = static_cast<int>(i);
+    }
+    DataFrame<int> copy = df.copy(execution::par.with_threads(4));
+    EXPECT_EQ(copy.layout(), Layout::ColumnMajor);
+    EXPECT_EQ(copy.get_row_name(49999), "row-50000");
+    EXPECT_TRUE(std::equal(df.begin(), df.end(), copy.begin()));
+}
+
+#endif // PARALLEL_TESTS_H
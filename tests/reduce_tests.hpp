@@ -0,0 +1,225 @@
+#ifndef REDUCE_TESTS_H
+#define REDUCE_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(reduce_tests, statisticsOnSeriesAndColumns) {
+    Series<double> values{2, 4, 4, 4, 5, 5, 7, 9};
+    EXPECT_EQ(values.sum(), 40.0);
+    EXPECT_EQ(values.mean(), 5.0);
+    EXPECT_EQ(values.var(0), 4.0);
+    EXPECT_EQ(values.std(0), 2.0);
+    EXPECT_DOUBLE_EQ(values.var(), 32.0 / 7.0);
+    EXPECT_EQ(values.prod(), 2.0 * 4 * 4 * 4 * 5 * 5 * 7 * 9);
+    EXPECT_EQ(values.argmin(), 0);
+    EXPECT_EQ(values.argmax(), 7);
+    EXPECT_EQ(values.count(), 8);
+
+    Series<int> ints{3, -1, 7, 7, -1};
+    EXPECT_EQ(ints.sum(), std::int64_t{15});
+    EXPECT_EQ(ints.argmin(), 1);
+    EXPECT_EQ(ints.argmax(), 2);
+
+    Series<double> with_nan{1.0, std::numeric_limits<double>::quiet_NaN(), 2.0};
+    EXPECT_EQ(with_nan.count(), 2);
+    EXPECT_TRUE(std::isnan(Series<double>{1.0}.var()));
+
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<int> df = create_dataframe<int, 2, 1000>(layout);
+        for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+            df[0, row_idx] = static_cast<int>(row_idx);
+            df[1, row_idx] = static_cast<int>(row_idx % 10) - 5;
+        }
+
+        EXPECT_EQ(df.column(0).sum(), std::int64_t{499500});
+        EXPECT_EQ(df.column(0).mean(), 499.5);
+        EXPECT_DOUBLE_EQ(df.column(0).var(0), (1000.0 * 1000.0 - 1.0) / 12.0);
+        EXPECT_EQ(df.column(1).argmin(), 0);
+        EXPECT_EQ(df.column(1).argmax(), 9);
+
+        Series<std::int64_t> sums = df.sum();
+        EXPECT_EQ(sums[0], 499500);
+        EXPECT_EQ(sums[1], -500);
+        EXPECT_EQ(df.mean()[1], -0.5);
+        EXPECT_EQ(df.count()[0], 1000);
+        EXPECT_EQ(df.argmax()[0], 999);
+    }
+}
+
+TEST(reduce_tests, nanNeverWinsArgminOrArgmax) {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // a NaN in front of every lane, the largest and smallest values behind them.
+    Series<double> values(17);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = i < 8 && i % 2 == 0 ? nan : static_cast<double>((i * 7) % 17);
+    }
+    values[12] = 20.0;
+    values[15] = -3.0;
+    for_each_simd_level([&] {
+        EXPECT_EQ(values.argmax(), 12);
+        EXPECT_EQ(values.argmin(), 15);
+        EXPECT_EQ(values.max(), 20.0);
+        EXPECT_EQ(values.min(), -3.0);
+        EXPECT_EQ(values.max(execution::par), 20.0);
+        EXPECT_EQ((Series<double>{nan, 1, 5, 2}.argmax()), 2);
+        EXPECT_EQ((Series<double>{nan, nan, nan}.argmin()), 0);
+        EXPECT_TRUE(std::isnan(Series<double>{nan, nan}.max()));
+    });
+
+    // a null run of NaNs ahead of the valid values.
+    values.set_null(12);
+    values.set_null(13);
+    EXPECT_EQ(values.argmax(), 7);
+    EXPECT_EQ(values.argmin(), 15);
+
+    // the strided and contiguous columns agree.
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<double> df = create_dataframe<double, 2, 3>(layout);
+        double            cells[2][3] = {{nan, 3.0, 1.0}, {nan, nan, nan}};
+        for (std::size_t col_idx = 0; col_idx < 2; col_idx++) {
+            for (std::size_t row_idx = 0; row_idx < 3; row_idx++) {
+                df[col_idx, row_idx] = cells[col_idx][row_idx];
+            }
+        }
+        for_each_simd_level([&] {
+            EXPECT_EQ(df.column(0).argmax(), 1);
+            EXPECT_EQ(df.column(0).argmin(), 2);
+            EXPECT_EQ(df.column(0).max(), 3.0);
+            EXPECT_EQ(df.argmax()[0], 1);
+            EXPECT_EQ(df.argmax()[1], 0);
+            EXPECT_EQ(df.argmin()[0], 2);
+            EXPECT_EQ(df.max(execution::par)[0], 3.0);
+        });
+    }
+}
+
+TEST(reduce_tests, summationModesAtEveryLevel) {
+    // lanes see 1, 1e100, 1, -1e100, only a compensated sum keeps the ones.
+    constexpr std::size_t n = 4000;
+
+    DataFrame<double> df = create_dataframe<double, 2, n>(Layout::ColumnMajor);
+    DataFrame<double> strided = create_dataframe<double, 2, n>(Layout::RowMajor);
+    double            pattern[4] = {1.0, 1e100, 1.0, -1e100};
+    for (std::size_t row_idx = 0; row_idx < n; row_idx++) {
+        df[0, row_idx]      = pattern[row_idx % 4];
+        strided[0, row_idx] = pattern[row_idx % 4];
+        df[1, row_idx]      = 0.1;
+    }
+
+    Series<float> tenths(1000003);
+    fill_series(tenths, 0.1f);
+    const double exact = static_cast<double>(0.1f) * static_cast<double>(tenths.size());
+
+    for_each_simd_level([&] {
+        EXPECT_EQ(df.column(0).sum(Summation::Kahan), 2000.0);
+        EXPECT_EQ(strided.column(0).sum(Summation::Kahan), 2000.0);
+
+        for (Summation mode : {Summation::Naive, Summation::Pairwise, Summation::Kahan}) {
+            EXPECT_NEAR(df.column(1).sum(mode), 400.0, 1e-9);
+            EXPECT_NEAR(df.column(1).var(1, mode), 0.0, 1e-20);
+        }
+
+        EXPECT_NEAR(tenths.sum(Summation::Pairwise), exact, exact * 1e-5);
+        EXPECT_NEAR(tenths.sum(Summation::Kahan), exact, exact * 1e-7);
+    });
+}
+
+TEST(reduce_tests, describeAllColumns) {
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<double> df = create_dataframe<double, 3, 101>(layout);
+        for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+            df[0, row_idx] = static_cast<double>(row_idx);
+            df[1, row_idx] = static_cast<double>(100 - row_idx) * 0.5;
+            df[2, row_idx] = row_idx % 2 == 0 ? std::numeric_limits<double>::quiet_NaN() : 1.0;
+        }
+
+        DataFrame<double> stats = df.describe();
+        EXPECT_EQ(stats.col_count(), 3);
+        EXPECT_EQ(stats.row_count(), 8);
+        EXPECT_EQ(stats.get_row_name(5), "50%");
+        EXPECT_EQ(stats.get_col_name(1), "col-2");
+
+        EXPECT_EQ((stats["col-1", "count"]), 101.0);
+        EXPECT_DOUBLE_EQ((stats["col-1", "mean"]), 50.0);
+        EXPECT_DOUBLE_EQ((stats["col-1", "std"]), df.column(0).std());
+        EXPECT_EQ((stats["col-1", "min"]), 0.0);
+        EXPECT_EQ((stats["col-1", "25%"]), 25.0);
+        EXPECT_EQ((stats["col-1", "50%"]), 50.0);
+        EXPECT_EQ((stats["col-1", "75%"]), 75.0);
+        EXPECT_EQ((stats["col-1", "max"]), 100.0);
+        EXPECT_EQ((stats["col-2", "25%"]), 12.5);
+        EXPECT_EQ((stats["col-3", "count"]), 50.0);
+        EXPECT_EQ((stats["col-3", "std"]), 0.0);
+
+        DataFrame<double> par_stats = df.describe(execution::par.with_threads(4));
+        for (std::size_t i = 0; i < stats.size(); i++) {
+            EXPECT_NEAR(par_stats[i], stats[i], 1e-9);
+        }
+    }
+
+    DataFrame<int> ints = create_dataframe<int, 1, 4>();
+    for (std::size_t row_idx = 0; row_idx < ints.row_count(); row_idx++) {
+        ints[0, row_idx] = static_cast<int>(row_idx * row_idx);
+    }
+    DataFrame<double> int_stats = ints.describe();
+    EXPECT_EQ((int_stats["col-1", "50%"]), 2.5);
+    EXPECT_EQ((int_stats["col-1", "max"]), 9.0);
+}
+
+TEST(reduce_tests, policyReductionsAreReproducible) {
+    constexpr std::size_t n = 100003;
+
+    std::vector<double> values(n);
+    std::uint64_t       state = 42;
+    for (double& value : values) {
+        state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+        value = static_cast<double>(state >> 11) * 0x1.0p-53 * 1e6 - 5e5;
+    }
+
+    Series<double> series(n);
+    std::copy(values.begin(), values.end(), series.data());
+    for (Summation mode : {Summation::Naive, Summation::Pairwise, Summation::Kahan}) {
+        double seq_sum = series.sum(execution::seq, mode);
+        EXPECT_NEAR(seq_sum, series.sum(mode), 1e-6);
+        for (std::size_t threads : {2, 3, 7}) {
+            EXPECT_EQ(series.sum(execution::par.with_threads(threads), mode), seq_sum);
+            EXPECT_EQ(series.var(execution::par_unseq.with_threads(threads), 1, mode), series.var(execution::seq, 1, mode));
+        }
+    }
+    EXPECT_EQ(series.min(execution::par), series.min());
+    EXPECT_EQ(series.max(execution::par), series.max());
+
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor}) {
+        DataFrame<double> df = create_dataframe<double, 3, n>(layout);
+        for (std::size_t row_idx = 0; row_idx < n; row_idx++) {
+            df[0, row_idx] = values[row_idx];
+            df[1, row_idx] = -values[row_idx];
+            df[2, row_idx] = values[n - 1 - row_idx] * 0.5;
+        }
+
+        Series<double> seq_sums = df.sum(execution::seq);
+        Series<double> seq_vars = df.var(execution::seq);
+        Series<double> mins     = df.min(execution::par.with_threads(4));
+        Series<double> maxs     = df.max(execution::par.with_threads(4));
+        for (std::size_t threads : {2, 5}) {
+            EXPECT_TRUE(df.sum(execution::par.with_threads(threads)).is_equal_with(seq_sums));
+            EXPECT_TRUE(df.var(execution::par.with_threads(threads)).is_equal_with(seq_vars));
+        }
+        for (std::size_t col_idx = 0; col_idx < 3; col_idx++) {
+            EXPECT_NEAR(seq_sums[col_idx], df.column(col_idx).sum(), 1e-6);
+            EXPECT_NEAR(seq_vars[col_idx], df.column(col_idx).var(), 1e-3);
+            EXPECT_EQ(df.column(col_idx).sum(execution::par.with_threads(3)), df.column(col_idx).sum(execution::seq));
+            EXPECT_EQ(mins[col_idx], df.column(col_idx).min());
+            EXPECT_EQ(maxs[col_idx], df.column(col_idx).max());
+        }
+        EXPECT_DOUBLE_EQ(df.std(execution::par)[0], std::sqrt(seq_vars[0]));
+        EXPECT_DOUBLE_EQ(df.mean(execution::par)[1], seq_sums[1] / static_cast<double>(n));
+    }
+}
+
+#endif // REDUCE_TESTS_H
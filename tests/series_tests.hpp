@@ -276,4 +276,28 @@ TEST(series_operators_tests, max_function) {
     }
 }
 
+TEST(series_move_tests, moveTakesBuffer) {
+    static_assert(std::is_nothrow_move_constructible_v<Series<int>>);
+    static_assert(std::is_nothrow_move_assignable_v<Series<int>>);
+
+    Series<int> a{1, 2, 3};
+    const int*  buffer = a.data();
+
+    Series<int> b{std::move(a)};
+    EXPECT_EQ(b.data(), buffer);
+    EXPECT_EQ(a.size(), 0);
+    EXPECT_EQ(a.data(), nullptr);
+
+    Series<int> c{7};
+    c = std::move(b);
+    EXPECT_EQ(c.data(), buffer);
+    EXPECT_EQ(c.size(), 3);
+    EXPECT_EQ(c[2], 3);
+
+    Series<int> d{1};
+    d = c + c;
+    EXPECT_EQ(d.size(), 3);
+    EXPECT_EQ(d[1], 4);
+}
+
 #endif // SERIES_TESTS_H
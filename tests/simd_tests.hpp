@@ -0,0 +1,67 @@
+#ifndef SIMD_TESTS_H
+#define SIMD_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(simd_tests, kernelsMatchScalarAtEveryLevel) {
+    // odd size so every width leaves a tail.
+    constexpr std::size_t n = 1003;
+
+    Series<double>       a(n);
+    Series<double>       b(n);
+    Series<std::int32_t> ia(n);
+    Series<std::int32_t> ib(n);
+    for (std::size_t i = 0; i < n; i++) {
+        a[i]  = static_cast<double>((i * 37) % 101) - 50.5;
+        b[i]  = static_cast<double>((i * 11) % 7) + 1.0;
+        ia[i] = static_cast<std::int32_t>((i * 37) % 101) - 50;
+        ib[i] = static_cast<std::int32_t>((i * 11) % 7) - 3;
+    }
+
+    for_each_simd_level([&] {
+        Series<double>       sum  = a + b;
+        Series<double>       quot = 2.0 / b;
+        Series<std::int32_t> prod = ia * ib;
+        Series<bool>         less = ia < ib;
+        Series<bool>         ge   = a >= 0.0;
+        for (std::size_t i = 0; i < n; i++) {
+            ASSERT_EQ(sum[i], a[i] + b[i]);
+            ASSERT_EQ(quot[i], 2.0 / b[i]);
+            ASSERT_EQ(prod[i], ia[i] * ib[i]);
+            ASSERT_EQ(less[i], ia[i] < ib[i]);
+            ASSERT_EQ(ge[i], a[i] >= 0.0);
+        }
+
+        EXPECT_EQ(a.max(), 49.5);
+        EXPECT_EQ(a.min(), -50.5);
+        EXPECT_EQ(ia.max(), 50);
+        EXPECT_EQ(ib.min(), -3);
+
+        Series<float> filled(n);
+        fill_series(filled, 1.5f);
+        EXPECT_EQ(filled.min(), 1.5f);
+        EXPECT_EQ(filled.max(), 1.5f);
+    });
+}
+
+TEST(simd_tests, contiguousColumnUsesKernel) {
+    DataFrame<double> df = create_dataframe<double, 3, 37>(Layout::ColumnMajor);
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = static_cast<double>(i);
+    }
+
+    for_each_simd_level([&] {
+        df.column(2) = df.column(0) * df.column(1);
+        for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+            ASSERT_EQ((df[2, row_idx]), (df[0, row_idx]) * (df[1, row_idx]));
+        }
+        EXPECT_EQ(df.column(1).max(), 73.0);
+        EXPECT_EQ(df.column(1).min(), 37.0);
+    });
+}
+
+#endif // SIMD_TESTS_H
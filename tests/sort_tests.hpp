@@ -0,0 +1,248 @@
+#ifndef SORT_TESTS_H
+#define SORT_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+TEST(sort_tests, radixKeyKeepsOrder) {
+    std::vector<double> values{-1e300, -2.5, -1.0, -0.0, 0.0, 1e-300, 1.0, 2.5, 1e300};
+    for (std::size_t i = 1; i < values.size(); i++) {
+        EXPECT_LE(radix_key(values[i - 1]), radix_key(values[i]));
+    }
+    EXPECT_EQ(radix_key(-0.0), radix_key(0.0));
+
+    std::vector<int> ints{std::numeric_limits<int>::min(), -7, -1, 0, 1, 7, std::numeric_limits<int>::max()};
+    for (std::size_t i = 1; i < ints.size(); i++) {
+        EXPECT_LT(radix_key(ints[i - 1]), radix_key(ints[i]));
+    }
+}
+
+TEST(sort_tests, radixArgsortMatchesStableSort) {
+    constexpr std::size_t n = 5000;
+
+    Series<double> values(n);
+    for (std::size_t i = 0; i < n; i++) {
+        values[i] = static_cast<double>(static_cast<int>((i * 7919) % 101) - 50) * 0.5;
+    }
+
+    for (bool ascending : {true, false}) {
+        std::vector<std::size_t> expected(n);
+        std::iota(expected.begin(), expected.end(), std::size_t{0});
+        std::stable_sort(expected.begin(), expected.end(), [&values, ascending](std::size_t a, std::size_t b) {
+            return ascending ? values[a] < values[b] : values[b] < values[a];
+        });
+
+        EXPECT_EQ(argsort(values, ascending), expected);
+    }
+}
+
+TEST(sort_tests, nanKeysSortLastOnEveryPath) {
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    double inf = std::numeric_limits<double>::infinity();
+
+    // one run shorter than the radix threshold and one longer, the NaN keep their order after every number.
+    for (std::size_t n : {radix_sort_threshold - 1, radix_sort_threshold, 4 * radix_sort_threshold}) {
+        Series<double> values(n);
+        for (std::size_t i = 0; i < n; i++) {
+            values[i] = static_cast<double>(static_cast<int>((i * 7919) % 31) - 15);
+        }
+        values[1]     = nan;
+        values[n / 2] = -nan;
+        values[n - 3] = inf;
+        values[n - 2] = -inf;
+
+        for (bool ascending : {true, false}) {
+            std::vector<std::size_t> perm = argsort(values, ascending);
+            ASSERT_EQ(perm.size(), n);
+            EXPECT_EQ(perm[n - 2], 1);
+            EXPECT_EQ(perm[n - 1], n / 2);
+            EXPECT_EQ(values[perm[0]], ascending ? -inf : inf);
+            EXPECT_EQ(values[perm[n - 3]], ascending ? inf : -inf);
+            for (std::size_t i = 1; i < n - 2; i++) {
+                EXPECT_TRUE(ascending ? values[perm[i - 1]] <= values[perm[i]] : values[perm[i - 1]] >= values[perm[i]]);
+            }
+        }
+
+        // the largest are the largest numbers, NaN is never picked before them.
+        std::vector<std::size_t> rows(n);
+        std::iota(rows.begin(), rows.end(), std::size_t{0});
+        select_top_k(values, rows, 2, true);
+        EXPECT_EQ(values[rows[0]], inf);
+        EXPECT_EQ(values[rows[1]], 15.0);
+    }
+}
+
+TEST(sort_tests, dfArgsortAndTake) {
+    DataFrame<int> df = create_dataframe<int, 2, 300>(Layout::ColumnMajor);
+
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<int>(row_idx % 3);
+        df[1, row_idx] = static_cast<int>(row_idx);
+    }
+
+    std::vector<std::size_t> perm = df.argsort("col-1", true);
+    ASSERT_EQ(perm.size(), df.row_count());
+    EXPECT_EQ(perm[0], 0);
+    EXPECT_EQ(perm[1], 3);
+    EXPECT_EQ(perm[100], 1);
+
+    auto rows = df.take(perm);
+    EXPECT_EQ(rows[100].name(), "row-2");
+
+    DataFrame<int> sorted{rows, Layout::ColumnMajor};
+    for (std::size_t row_idx = 1; row_idx < sorted.row_count(); row_idx++) {
+        EXPECT_LE((sorted[0, row_idx - 1]), (sorted[0, row_idx]));
+    }
+    EXPECT_EQ((sorted[1, 100]), 1);
+
+    EXPECT_THROW(df.take({0, 300}), std::out_of_range);
+}
+
+TEST(sort_tests, dfTakeOnConstFrame) {
+    DataFrame<int> df = create_dataframe<int, 2, 5>(Layout::ColumnMajor);
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<int>(10 - row_idx);
+        df[1, row_idx] = static_cast<int>(row_idx);
+    }
+    const DataFrame<int>& const_df = df;
+
+    auto rows = const_df.take(const_df.argsort("col-1", true));
+    static_assert(std::is_same_v<decltype(rows.at(0)), RowView<const int>>);
+    ASSERT_EQ(rows.size(), 5);
+    EXPECT_EQ(rows.at(0).name(), "row-5");
+    EXPECT_EQ(rows.at(0)[1], 4);
+    EXPECT_EQ(rows.row_index(4), 0);
+
+    testing::internal::CaptureStdout();
+    rows.log();
+    std::string printed = testing::internal::GetCapturedStdout();
+    EXPECT_LT(printed.find("row-5"), printed.find("row-1"));
+
+    EXPECT_THROW(const_df.take({5}), std::out_of_range);
+}
+
+TEST(sort_tests, parallelSortIsStableAndDeterministic) {
+    constexpr std::size_t n = 100000;
+
+    Series<int> values(n);
+    for (std::size_t i = 0; i < n; i++) {
+        values[i] = static_cast<int>((i * 2654435761u) % 977);
+    }
+
+    for (bool ascending : {true, false}) {
+        std::vector<std::size_t> expected = argsort(values, ascending);
+        for (std::size_t threads : {1, 2, 3, 4, 7}) {
+            EXPECT_EQ(argsort(execution::par.with_threads(threads), values, ascending), expected);
+        }
+    }
+}
+
+TEST(sort_tests, parallelSortWithNanMatchesSequential) {
+    constexpr std::size_t n = 100000;
+
+    Series<double> values(n);
+    for (std::size_t i = 0; i < n; i++) {
+        values[i] = i % 37 == 0 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>((i * 2654435761u) % 977) - 488.0;
+    }
+
+    for (bool ascending : {true, false}) {
+        std::vector<std::size_t> expected = argsort(execution::seq, values, ascending);
+        EXPECT_TRUE(std::isnan(values[expected.back()]));
+        for (std::size_t threads : {2, 4, 7}) {
+            EXPECT_EQ(argsort(execution::par.with_threads(threads), values, ascending), expected);
+        }
+    }
+}
+
+TEST(sort_tests, dfParallelSort) {
+    DataFrame<double> df = create_dataframe<double, 2, 40000>();
+
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<double>(row_idx % 10);
+        df[1, row_idx] = static_cast<double>(row_idx);
+    }
+
+    auto seq_rows = df.sort("col-1", true);
+    auto par_rows = df.sort(execution::par.with_threads(4), "col-1", true);
+    EXPECT_EQ(par_rows.row_indices(), seq_rows.row_indices());
+    EXPECT_EQ(par_rows[1][1], 10.0);
+}
+
+TEST(sort_tests, multiKeyMixedDirection) {
+    DataFrame<int> df = create_dataframe<int, 3, 6>();
+
+    // col-1 col-2 col-3
+    int values[18] = {1, 5, 0, 0, 7, 1, 1, 9, 2, 0, 7, 3, 1, 5, 4, 0, 2, 5};
+    for (std::size_t i = 0; i < df.size(); i++) {
+        df[i] = values[i];
+    }
+
+    auto rows = df.sort({{"col-1", asc}, {"col-2", desc}});
+    EXPECT_EQ(rows.row_indices(), (std::vector<std::size_t>{1, 3, 5, 2, 0, 4}));
+
+    auto par_rows = df.sort(execution::par.with_threads(2), {{"col-1", desc}, {"col-2", asc}});
+    EXPECT_EQ(par_rows.row_indices(), (std::vector<std::size_t>{0, 4, 2, 5, 1, 3}));
+
+    auto single = df.sort({{"col-3", desc}});
+    EXPECT_EQ(single.row_indices(), (std::vector<std::size_t>{5, 4, 3, 2, 1, 0}));
+
+    EXPECT_THROW(df.sort({{"col-1", asc}, {"missing", asc}}), std::out_of_range);
+}
+
+TEST(sort_tests, parallelMultiKeyMatchesSequential) {
+    DataFrame<int> df = create_dataframe<int, 2, 50000>(Layout::ColumnMajor);
+
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<int>(row_idx % 7);
+        df[1, row_idx] = static_cast<int>((row_idx * 31) % 13);
+    }
+
+    auto seq_rows = df.sort({{"col-1", desc}, {"col-2", asc}});
+    auto par_rows = df.sort(execution::par.with_threads(3), {{"col-1", desc}, {"col-2", asc}});
+    EXPECT_EQ(par_rows.row_indices(), seq_rows.row_indices());
+}
+
+TEST(sort_tests, nlargestNsmallest) {
+    DataFrame<int> df = create_dataframe<int, 2, 8>();
+
+    int values[8] = {4, 9, 1, 9, 7, 1, 3, 8};
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = values[row_idx];
+        df[1, row_idx] = static_cast<int>(row_idx);
+    }
+
+    auto largest = df.nlargest("col-1", 3);
+    EXPECT_EQ(largest.row_indices(), (std::vector<std::size_t>{1, 3, 7}));
+    EXPECT_EQ(largest[2]["col-2"], 7);
+
+    auto smallest = df.column(0).nsmallest(3);
+    EXPECT_EQ(smallest.row_indices(), (std::vector<std::size_t>{2, 5, 6}));
+
+    EXPECT_EQ(df.nsmallest("col-1", 100).row_indices(), df.sort("col-1", true).row_indices());
+
+    auto sorted = df.sort("col-2", false);
+    EXPECT_EQ(sorted.nlargest("col-1", 2).row_indices(), (std::vector<std::size_t>{3, 1}));
+    EXPECT_EQ(sorted.size(), 8);
+}
+
+TEST(sort_tests, parallelTopKMatchesSequential) {
+    DataFrame<double> df = create_dataframe<double, 1, 70000>();
+
+    for (std::size_t row_idx = 0; row_idx < df.row_count(); row_idx++) {
+        df[0, row_idx] = static_cast<double>((row_idx * 7919) % 1000);
+    }
+
+    for (std::size_t threads : {2, 4}) {
+        EXPECT_EQ(df.nlargest(execution::par.with_threads(threads), "col-1", 50).row_indices(), df.nlargest("col-1", 50).row_indices());
+        EXPECT_EQ(df.nsmallest(execution::par.with_threads(threads), "col-1", 50).row_indices(), df.nsmallest("col-1", 50).row_indices());
+    }
+
+    std::vector<std::size_t> sorted = df.sort("col-1").row_indices();
+    sorted.resize(50);
+    EXPECT_EQ(df.nlargest("col-1", 50).row_indices(), sorted);
+}
+
+#endif // SORT_TESTS_H
@@ -2,9 +2,10 @@
 #define TEST_UTILS_H
 
 #include <dataframe>
+#include <gtest/gtest.h>
 
 template<typename T, std::size_t COL_COUNT, std::size_t ROW_COUNT>
-df::DataFrame<T> create_dataframe() {
+df::DataFrame<T> create_dataframe(df::Layout layout = df::Layout::RowMajor) {
     std::vector<std::string> col_names{};
     for (std::size_t i = 1; i <= COL_COUNT; i++) {
         col_names.push_back(std::string{"col-" + std::to_string(i)});
@@ -15,7 +16,7 @@ df::DataFrame<T> create_dataframe() {
         row_names.push_back(std::string{"row-" + std::to_string(i)});
     }
 
-    return df::DataFrame<T>{col_names, row_names};
+    return df::DataFrame<T>{col_names, row_names, layout};
 }
 
 template<typename T>
@@ -23,4 +24,16 @@ df::Series<T> make_series(std::initializer_list<T> data) {
     return df::Series<T>{data};
 }
 
+// runs fn once per simd instruction set available on this cpu, scalar included.
+template<typename Fn>
+void for_each_simd_level(Fn fn) {
+    for (df::simd::Level level : {df::simd::Level::Scalar, df::simd::Level::SSE42, df::simd::Level::AVX2, df::simd::Level::AVX512}) {
+        if (level > df::simd::detect_level()) { continue; }
+        df::simd::set_level(level);
+        SCOPED_TRACE(df::simd::level_name(level));
+        fn();
+    }
+    df::simd::set_level(df::simd::detect_level());
+}
+
 #endif // TEST_UTILS_H
@@ -0,0 +1,108 @@
+#ifndef TYPED_TESTS_H
+#define TYPED_TESTS_H
+
+#include "test_utils.hpp"
+#include <dataframe>
+#include <gtest/gtest.h>
+
+using namespace df;
+
+using Trades = TypedDataFrame<double, std::int64_t, bool>;
+
+TEST(typed_tests, columnsKeepTheirOwnType) {
+    Trades df({"price", "volume", "flag"}, {"row-1", "row-2", "row-3", "row-4"});
+    EXPECT_EQ(df.shape().col_count, 3);
+    EXPECT_EQ(df.shape().row_count, 4);
+    EXPECT_EQ(df.value_bytes(), 4 * (sizeof(double) + sizeof(std::int64_t) + sizeof(bool)));
+    EXPECT_FALSE(df.at<2>(3));
+    EXPECT_EQ(df.at<1>(0), 0);
+
+    static_assert(std::is_same_v<decltype(df.column<1>()), Series<std::int64_t>&>);
+    static_assert(std::is_same_v<Trades::column_data_type<2>, bool>);
+
+    for (std::size_t row_idx = 0; row_idx < 4; row_idx++) {
+        df.set_row(row_idx, 10.0 + static_cast<double>(row_idx), static_cast<std::int64_t>(100 * (row_idx + 1)), row_idx % 2 == 0);
+    }
+    EXPECT_EQ(df.row("row-3"), (Trades::row_type{12.0, 300, true}));
+    EXPECT_THROW(df.at<0>(4), std::out_of_range);
+
+    // the Series api per column, expressions mix the column types.
+    df.column<0>() *= 2.0;
+    Series<double> notional = df.column<0>() * df.column<1>();
+    EXPECT_DOUBLE_EQ(notional[1], 22.0 * 200.0);
+    EXPECT_EQ(df.column<std::int64_t>("volume").sum(), 1000);
+    EXPECT_DOUBLE_EQ(df.column<double>("price").max(), 26.0);
+    EXPECT_EQ(std::count(df.column<bool>("flag").begin(), df.column<bool>("flag").end(), true), 2);
+    EXPECT_THROW(df.column<double>("volume"), std::invalid_argument);
+
+    std::vector<std::string> names;
+    df.for_each_column([&names](const std::string& col_name, const auto& col) {
+        names.push_back(col_name);
+        EXPECT_EQ(col.size(), 4);
+    });
+    EXPECT_EQ(names, (std::vector<std::string>{"price", "volume", "flag"}));
+
+    DataFrame<double> dense = df.to_dataframe<double>();
+    EXPECT_DOUBLE_EQ((dense["volume", "row-2"]), 200.0);
+    EXPECT_DOUBLE_EQ((dense["flag", "row-1"]), 1.0);
+}
+
+TEST(typed_tests, takeFilterAndSortGatherEveryColumn) {
+    Trades df({"price", "volume", "flag"}, {"row-1", "row-2", "row-3", "row-4", "row-5"});
+    for (std::size_t row_idx = 0; row_idx < 5; row_idx++) {
+        df.set_row(row_idx, static_cast<double>((row_idx * 3) % 5), static_cast<std::int64_t>(row_idx), row_idx % 2 == 1);
+    }
+    df.column<0>().set_null(2);
+
+    Trades sorted = df.sort("price", true);
+    EXPECT_EQ(sorted.row_labels().name(0), "row-1");
+    EXPECT_EQ(sorted.row_labels().name(4), "row-3");
+    EXPECT_FALSE(sorted.column<0>().is_valid(4));
+    EXPECT_EQ(sorted.column<1>().null_count(), 0);
+    for (std::size_t row_idx = 0; row_idx < 5; row_idx++) {
+        EXPECT_EQ(sorted.row(row_idx), df.row(sorted.row_labels().name(row_idx)));
+    }
+
+    Trades flagged = df.filter(df.column<1>() > std::int64_t{1});
+    EXPECT_EQ(flagged.row_count(), 3);
+    EXPECT_EQ(flagged.get_row_idx("row-3"), 0);
+    EXPECT_EQ(flagged.at<1>(2), 4);
+
+    Trades by_flag = df.sort("flag", false);
+    EXPECT_TRUE(by_flag.at<2>(0));
+    EXPECT_EQ(by_flag.row_labels().name(0), "row-2");
+
+    EXPECT_THROW(df.take({0, 5}), std::out_of_range);
+
+    flagged = df;
+    EXPECT_EQ(flagged.row_count(), 5);
+    EXPECT_FALSE(flagged.column<0>().is_valid(2));
+}
+
+TEST(typed_tests, columnsKeepTheRowCount) {
+    Trades df({"price", "volume", "flag"}, {"row-1", "row-2", "row-3"});
+
+    // same size assignments replace the values.
+    df.column<0>() = Series<double>{1.0, 2.0, 3.0};
+    df.column<0>() = df.column<0>() * 2.0;
+    df.column<double>("price") += 1.0;
+    EXPECT_DOUBLE_EQ(df.at<0>(2), 7.0);
+
+    EXPECT_DEATH(df.column<0>() = Series<double>{1.0}, "size changing assignment");
+    EXPECT_DEATH(df.column<std::int64_t>("volume") = Series<std::int64_t>(5), "size changing assignment");
+
+    // a column copied out of the frame is a plain Series again, and frames of other shapes can still be assigned.
+    Series<double> prices = df.column<0>();
+    prices                = Series<double>{1.0};
+    EXPECT_EQ(prices.size(), 1);
+
+    Trades other({"price", "volume", "flag"}, {"row-1"});
+    df = other;
+    EXPECT_EQ(df.row_count(), 1);
+    EXPECT_DEATH(df.column<0>() = (Series<double>{1.0, 2.0}), "size changing assignment");
+    df = Trades({"price", "volume", "flag"}, {"row-1", "row-2"});
+    EXPECT_EQ(df.column<2>().size(), 2);
+    EXPECT_DEATH(df.column<0>() = Series<double>{1.0}, "size changing assignment");
+}
+
+#endif // TYPED_TESTS_H